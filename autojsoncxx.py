@@ -82,6 +82,15 @@ class UnrecognizedOption(InvalidDefinitionError):
         return "Unrecognized option: " + repr(self.option)
 
 
+class InvalidOptionValue(InvalidDefinitionError):
+    def __init__(self, option, value):
+        self.option = option
+        self.value = value
+
+    def __str__(self):
+        return "Invalid value for option {}: {}".format(repr(self.option), repr(self.value))
+
+
 class UnsupportedTypeError(InvalidDefinitionError):
     def __init__(self, type_name):
         self.type_name = type_name
@@ -99,13 +108,75 @@ else:
         return '"' + ''.join('\\x{:02x}'.format(char) for char in byte_string) + '"'
 
 
+# escape a UTF-8 byte string and wrap it in quotes, exactly as `rapidjson::Writer` does,
+# so that precomputed tokens are byte-identical to what the writer would produce
+def json_string_token(byte_string):
+    special = {0x22: b'\\"', 0x5c: b'\\\\', 0x08: b'\\b', 0x0c: b'\\f', 0x0a: b'\\n', 0x0d: b'\\r', 0x09: b'\\t'}
+    result = bytearray(b'"')
+    for char in bytearray(byte_string):
+        if char in special:
+            result += special[char]
+        elif char < 0x20:
+            result += '\\u{:04X}'.format(char).encode('ascii')
+        else:
+            result.append(char)
+    result += b'"'
+    return bytes(result)
+
+
+# FNV-1a with a seed, the same function as `validation::string_hash`
+def string_hash(byte_string, seed):
+    h = 2166136261 ^ seed
+    for char in bytearray(byte_string):
+        h = ((h ^ char) * 16777619) & 0xffffffff
+    return h
+
+
+# find a seed for which every string lands in its own slot of a table whose size is a power of two
+def perfect_hash_table(byte_strings):
+    size = 1
+    while size < len(byte_strings):
+        size *= 2
+    while True:
+        for seed in range(1, 1024):
+            slots = [string_hash(s, seed) & (size - 1) for s in byte_strings]
+            if len(set(slots)) == len(slots):
+                table = [None] * size
+                for s, slot in zip(byte_strings, slots):
+                    table[slot] = s
+                return seed, table
+        size *= 2
+
+
 def check_identifier(identifier):
     if not re.match(r'^[A-Za-z_]\w*$', identifier):
         raise InvalidIdentifier(identifier)
 
 
+def qualified_name(namespace, name):
+    if namespace is None:
+        return '::' + name
+    if namespace.startswith('::'):
+        return namespace + '::' + name
+    return '::' + namespace + '::' + name
+
+
+def check_namespace(namespace):
+    if namespace is not None and not re.match(r'^(?:::)?[A-Za-z_]\w*(?:::[A-Za-z_]\w*)*$', namespace):
+        raise InvalidNamespace(namespace)
+
+
+def wrap_in_namespace(namespace, definition):
+    if namespace is not None:
+        for space in reversed(namespace.split('::')):
+            if space:
+                definition = 'namespace {} {{ {} }}\n'.format(space, definition)
+    return definition
+
+
 class ClassInfo(object):
-    accept_options = {"name", "namespace", "parse_mode", "members", "constructor_code", "comment", "no_duplicates"}
+    accept_options = {"name", "namespace", "parse_mode", "members", "constructor_code", "comment", "no_duplicates",
+                      "encoding"}
 
     def __init__(self, record):
         self._name = record['name']
@@ -114,11 +185,14 @@ class ClassInfo(object):
         self._namespace = record.get("namespace", None)
         self._constructor_code = record.get("constructor_code", "")
         self._no_duplicates = record.get("no_duplicates", False)
+        self._encoding = record.get("encoding", "object")
 
         check_identifier(self._name)
 
-        if self._namespace is not None and not re.match(r'^(?:::)?[A-Za-z_]\w*(?:::[A-Za-z_]\w*)*$', self._namespace):
-            raise InvalidNamespace(self._namespace)
+        if self._encoding not in ("object", "positional"):
+            raise InvalidOptionValue('encoding', self._encoding)
+
+        check_namespace(self._namespace)
 
         for op in record:
             if op not in ClassInfo.accept_options:
@@ -130,11 +204,7 @@ class ClassInfo(object):
 
     @property
     def qualified_name(self):
-        if self.namespace is None:
-            return '::' + self.name
-        if self.namespace.startswith('::'):
-            return self.namespace + '::' + self.name
-        return '::' + self.namespace + '::' + self.name
+        return qualified_name(self.namespace, self.name)
 
     @property
     def members(self):
@@ -156,6 +226,10 @@ class ClassInfo(object):
     def no_duplicates(self):
         return self._no_duplicates
 
+    @property
+    def positional(self):
+        return self._encoding == "positional"
+
 
 class ClassDefinitionCodeGenerator(object):
     def __init__(self, class_info):
@@ -181,18 +255,198 @@ class ClassDefinitionCodeGenerator(object):
             .format(name=self.class_info.name, declarations=self.member_declarations(),
                     constructor=self.constructor())
 
-        if self.class_info.namespace is not None:
-            for space in reversed(self.class_info.namespace.split('::')):
-                if space:
-                    class_def = 'namespace {} {{ {} }}\n'.format(space, class_def)
-        return class_def
+        return wrap_in_namespace(self.class_info.namespace, class_def)
+
+
+# an enum declared in the definition file; each enumerator is an identifier,
+# or a pair of the identifier and its spelling in JSON
+class EnumInfo(object):
+    accept_options = {"name", "namespace", "enumerators", "scoped", "comment"}
+
+    def __init__(self, record):
+        self._name = record['name']
+        self._namespace = record.get("namespace", None)
+        self._scoped = record.get("scoped", False)
+        self._enumerators = []
+
+        check_identifier(self._name)
+        check_namespace(self._namespace)
+
+        if not isinstance(self._scoped, bool):
+            raise InvalidOptionValue('scoped', self._scoped)
+
+        enumerators = record['enumerators']
+        if not isinstance(enumerators, list) or not enumerators:
+            raise InvalidOptionValue('enumerators', enumerators)
+        for e in enumerators:
+            if isinstance(e, str):
+                e = [e, e]
+            if not isinstance(e, list) or len(e) != 2 or not all(isinstance(x, str) for x in e):
+                raise InvalidOptionValue('enumerators', e)
+            check_identifier(e[0])
+            self._enumerators.append((e[0], e[1].encode('utf-8')))
+
+        for values in zip(*self._enumerators):
+            if len(set(values)) != len(values):
+                raise InvalidOptionValue('enumerators', enumerators)
+
+        for op in record:
+            if op not in EnumInfo.accept_options:
+                raise UnrecognizedOption(op)
+
+    @property
+    def name(self):
+        return self._name
+
+    @property
+    def namespace(self):
+        return self._namespace
 
+    @property
+    def qualified_name(self):
+        return qualified_name(self.namespace, self.name)
+
+    @property
+    def scoped(self):
+        return self._scoped
+
+    # pairs of the identifier and the UTF-8 spelling, in the order of their values
+    @property
+    def enumerators(self):
+        return self._enumerators
+
+    def enumerator_name(self, identifier):
+        if self.scoped:
+            return self.qualified_name + '::' + identifier
+        return qualified_name(self.namespace, identifier)
+
+    def enum_definition(self):
+        definition = '{} {} {{ {} }};'.format('enum class' if self.scoped else 'enum', self.name,
+                                              ', '.join(e[0] for e in self.enumerators))
+        return wrap_in_namespace(self.namespace, definition)
+
+
+# an alternative of a tagged union, named in JSON by its tag
+class AlternativeInfo(object):
+    accept_options = {"tag", "comment"}
+
+    def __init__(self, record):
+        if not isinstance(record, list) or not 2 <= len(record) <= 3 or not all(isinstance(x, str) for x in record[:2]):
+            raise InvalidOptionValue('oneOf', record)
+        self._type_name = record[0]
+        self._variable_name = record[1]
+        options = record[2] if len(record) == 3 else {}
+
+        if '*' in self.type_name or '&' in self.type_name:
+            raise UnsupportedTypeError(self.type_name)
+        check_identifier(self.variable_name)
+
+        for op in options:
+            if op not in AlternativeInfo.accept_options:
+                raise UnrecognizedOption(op)
+        tag = options.get('tag', self.variable_name)
+        if not isinstance(tag, str):
+            raise InvalidOptionValue('tag', tag)
+        self._tag = tag.encode('utf-8')
+
+    @property
+    def type_name(self):
+        return self._type_name
+
+    @property
+    def variable_name(self):
+        return self._variable_name
+
+    @property
+    def tag(self):
+        return self._tag
+
+
+# a tagged union declared in the definition file: a struct holding every alternative inline,
+# written as the object of the chosen one with the discriminator key naming it
+class UnionInfo(object):
+    accept_options = {"name", "namespace", "discriminator", "oneOf", "comment"}
+
+    def __init__(self, record):
+        self._name = record['name']
+        self._namespace = record.get("namespace", None)
+        self._discriminator = record.get("discriminator", "type")
+
+        check_identifier(self._name)
+        check_namespace(self._namespace)
+
+        if not isinstance(self._discriminator, str) or not self._discriminator:
+            raise InvalidOptionValue('discriminator', self._discriminator)
+
+        alternatives = record['oneOf']
+        if not isinstance(alternatives, list) or not alternatives:
+            raise InvalidOptionValue('oneOf', alternatives)
+        self._alternatives = [AlternativeInfo(r) for r in alternatives]
+
+        for values in ([a.variable_name for a in self.alternatives], [a.tag for a in self.alternatives]):
+            if len(set(values)) != len(values):
+                raise InvalidOptionValue('oneOf', alternatives)
+
+        for op in record:
+            if op not in UnionInfo.accept_options:
+                raise UnrecognizedOption(op)
+
+    @property
+    def name(self):
+        return self._name
+
+    @property
+    def namespace(self):
+        return self._namespace
+
+    @property
+    def qualified_name(self):
+        return qualified_name(self.namespace, self.name)
+
+    @property
+    def discriminator(self):
+        return self._discriminator.encode('utf-8')
+
+    @property
+    def alternatives(self):
+        return self._alternatives
+
+    # the alternatives take the place of members when type names are checked and fingerprinted
+    @property
+    def members(self):
+        return self._alternatives
+
+    def tag_enumerator(self, alternative):
+        return self.qualified_name + '::' + alternative.variable_name + '_tag'
+
+    def union_definition(self):
+        definition = 'struct {name} {{\n enum Tag {{ {tags} }};\n Tag tag;\n {declarations}\n\n' \
+                     'explicit {name}() : tag({first}), {init} {{}}\n}};' \
+            .format(name=self.name,
+                    tags=', '.join(a.variable_name + '_tag' for a in self.alternatives),
+                    declarations='\n'.join(a.type_name + ' ' + a.variable_name + ';' for a in self.alternatives),
+                    first=self.alternatives[0].variable_name + '_tag',
+                    init=', '.join(a.variable_name + '()' for a in self.alternatives))
+        return wrap_in_namespace(self.namespace, definition)
 
 class MemberInfo(object):
-    accept_options = {'default', 'required', 'json_key', 'comment', 'minLength', 'maxLength', 'pattern', 'format', 'enum', 'oneOf','containerTypeProperty', 'minimum', 'maximum', 'minItems', 'maxItems', 'uniqueItems'}
+    accept_options = {'default', 'required', 'json_key', 'comment', 'minLength', 'maxLength', 'pattern', 'format', 'enum', 'oneOf','containerTypeProperty', 'minimum', 'maximum', 'minItems', 'maxItems', 'uniqueItems', 'precision', 'fixed', 'contentEncoding'}
+    constraint_options = ('minLength', 'maxLength', 'pattern', 'enum', 'minimum', 'maximum', 'minItems', 'maxItems',
+                          'uniqueItems')
+
+    # the narrowest first, signed before unsigned of the same width
+    integer_types = (('signed char', -2 ** 7, 2 ** 7 - 1), ('unsigned char', 0, 2 ** 8 - 1),
+                     ('short', -2 ** 15, 2 ** 15 - 1), ('unsigned short', 0, 2 ** 16 - 1),
+                     ('int', -2 ** 31, 2 ** 31 - 1), ('unsigned', 0, 2 ** 32 - 1),
+                     ('long long', -2 ** 63, 2 ** 63 - 1), ('unsigned long long', 0, 2 ** 64 - 1))
+
+    # the compact types of `string` members by their format; other formats are kept as `std::string`
+    format_types = {'uuid': 'autojsoncxx::uuid', 'ipv4': 'autojsoncxx::ipv4_address',
+                    'ipv6': 'autojsoncxx::ipv6_address', 'date-time': 'std::chrono::system_clock::time_point'}
 
     def __init__(self, record):
         self._record = record
+        self._type_name = record[0]
 
         if '*' in self.type_name or '&' in self.type_name:
             raise UnsupportedTypeError(self.type_name)
@@ -202,10 +456,76 @@ class MemberInfo(object):
         if len(record) > 3:
             raise UnrecognizedOption(record[3:])
 
+        if self.precision is not None:
+            if isinstance(self.precision, bool) or not isinstance(self.precision, int) \
+                    or not 0 <= self.precision <= 17:
+                raise InvalidOptionValue('precision', self.precision)
+            if self.type_name not in ('double', 'float'):
+                raise UnsupportedTypeError(self.type_name)
+        if self.fixed and self.precision is None:
+            raise InvalidOptionValue('fixed', self.fixed)
+        if self.option('contentEncoding') is not None:
+            if self.option('contentEncoding') != 'base64':
+                raise InvalidOptionValue('contentEncoding', self.option('contentEncoding'))
+            if self.type_name != 'string':
+                raise UnsupportedTypeError(self.type_name)
+
+        for op in ('minLength', 'maxLength', 'minItems', 'maxItems'):
+            value = self.option(op)
+            if value is not None and (isinstance(value, bool) or not isinstance(value, int) or value < 0):
+                raise InvalidOptionValue(op, value)
+        for op in ('minimum', 'maximum'):
+            value = self.option(op)
+            if value is not None and (isinstance(value, bool) or not isinstance(value, Number)):
+                raise InvalidOptionValue(op, value)
+        if self.option('pattern') is not None and not isinstance(self.option('pattern'), str):
+            raise InvalidOptionValue('pattern', self.option('pattern'))
+        if self.option('uniqueItems') is not None and not isinstance(self.option('uniqueItems'), bool):
+            raise InvalidOptionValue('uniqueItems', self.option('uniqueItems'))
+        enum = self.option('enum')
+        if enum is not None:
+            if not isinstance(enum, list) or not enum or not (
+                        all(isinstance(v, str) for v in enum) or
+                        all(isinstance(v, Number) and not isinstance(v, bool) for v in enum)):
+                raise InvalidOptionValue('enum', enum)
+
+        if self._type_name == 'integer':
+            self._type_name = self.narrowest_integer_type()
+        elif self._type_name == 'string':
+            self._type_name = self.formatted_string_type()
+
+    # the type of an `integer` member, chosen from its bounds, which default to those of `int`
+    def narrowest_integer_type(self):
+        bounds = []
+        for op, default in (('minimum', -2 ** 31), ('maximum', 2 ** 31 - 1)):
+            value = self.option(op)
+            if value is not None and value != int(value):
+                raise InvalidOptionValue(op, value)
+            bounds.append(default if value is None else int(value))
+        for name, low, high in MemberInfo.integer_types:
+            if low <= bounds[0] and bounds[1] <= high:
+                return name
+        raise UnsupportedTypeError('integer')
+
+    # the type of a `string` member, parsed and validated by the handler of its format or encoding
+    def formatted_string_type(self):
+        string_format = self.option('format')
+        if string_format is not None and not isinstance(string_format, str):
+            raise InvalidOptionValue('format', string_format)
+        if self.option('contentEncoding') is not None:
+            type_name = 'autojsoncxx::bytes'
+        elif string_format in MemberInfo.format_types:
+            type_name = MemberInfo.format_types[string_format]
+        else:
+            return 'std::string'
+        for op in ('minLength', 'maxLength', 'pattern', 'enum'):
+            if self.option(op) is not None:
+                raise InvalidOptionValue(op, self.option(op))
+        return type_name
 
     @property
     def type_name(self):
-        return self._record[0]
+        return self._type_name
 
     @property
     def variable_name(self):
@@ -229,6 +549,30 @@ class MemberInfo(object):
         except (IndexError, KeyError):
             return None
 
+    @property
+    def precision(self):
+        try:
+            return self._record[2]['precision']
+        except (IndexError, KeyError):
+            return None
+
+    @property
+    def fixed(self):
+        try:
+            return self._record[2]['fixed']
+        except (IndexError, KeyError):
+            return False
+
+    def option(self, name):
+        try:
+            return self._record[2][name]
+        except (IndexError, KeyError):
+            return None
+
+    @property
+    def has_constraints(self):
+        return any(self.option(op) is not None for op in MemberInfo.constraint_options)
+
     @property
     def constructor_args(self):
         return MemberInfo.cpp_repr(self.default)
@@ -271,25 +615,63 @@ class HelperClassCodeGenerator(object):
         return '\n'.join(', handler_{}(&obj->{})'.format(i, m.variable_name)
                          for i, m in enumerate(self.members_info))
 
+    # required members, or all of them when duplicates are rejected, own a bit of `has_flags` each
+    def flagged_members(self):
+        return [m for m in self.members_info if self.class_info.no_duplicates or m.is_required]
+
+    def flag_word_count(self):
+        return (len(self.flagged_members()) + 63) // 64
+
+    def flag_bit(self, member_info):
+        index = [m.variable_name for m in self.flagged_members()].index(member_info.variable_name)
+        return index // 64, 1 << (index % 64)
+
     def flags_declaration(self):
-        return '\n'.join('bool has_{};'.format(m.variable_name) for m in self.members_info
-                         if self.class_info.no_duplicates or m.is_required)
+        if not self.flag_word_count():
+            return ''
+        return '\nutility::uint64_t has_flags[{}];'.format(self.flag_word_count())
+
+    # the key of the reader is gone when the error is reaped
+    def unknown_key_declaration(self):
+        return '\nerror::RejectedText unknown_key;' if self.class_info.strict_parsing else ''
 
     def flags_reset(self):
-        return '\n'.join(self.flag_statement(m, "false") for m in self.members_info)
+        return '\n'.join('has_flags[{}] = 0;'.format(w) for w in range(self.flag_word_count()))
+
+    def required_masks(self):
+        masks = [0] * self.flag_word_count()
+        for m in self.members_info:
+            if m.is_required:
+                word, bit = self.flag_bit(m)
+                masks[word] |= bit
+        return [(w, mask) for w, mask in enumerate(masks) if mask]
 
     def post_validation(self):
-        return '\n'.join('if (!has_{0}) set_missing_required("{0}");'
-                             .format(m.variable_name) for m in self.members_info if m.is_required)
+        checks = ['(has_flags[{0}] & 0x{1:x}ULL) != 0x{1:x}ULL'.format(w, mask) for w, mask in self.required_masks()]
+        if not checks:
+            return ''
+        return 'if ({}) the_error.set<error::RequiredFieldMissingError>();'.format(' || '.join(checks))
+
+    # only on failure
+    def missing_members_listing(self):
+        return '\n'.join('if (!(has_flags[{1}] & 0x{2:x}ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)'
+                         '->add_missing_member(errs, "{0}");'.format(m.variable_name, *self.flag_bit(m))
+                         for m in self.members_info if m.is_required)
 
     def key_event_handling(self):
         return '\n'.join('else if (utility::string_equal(str, length, {key}, {key_length}))\n\
                          {{ state={state}; {dup_check} {set_flag} }}'
                              .format(key=cstring_literal(m.json_key), key_length=len(m.json_key),
                                      state=i, dup_check=self.check_for_duplicate_key(m),
-                                     set_flag=self.flag_statement(m, "true"))
+                                     set_flag=self.flag_setting(m))
                          for i, m in enumerate(self.members_info))
 
+    def member_selection(self):
+        return '\n\n'.join('case {state}:\n    state = {state};\n    {dup_check} {set_flag}\n    break;'
+                               .format(state=i, dup_check=self.check_for_duplicate_key(m),
+                                       set_flag=self.flag_setting(m))
+                           for i, m in enumerate(self.members_info))
+
     def event_forwarding(self, call_text):
         return '\n\n'.join('case {i}:\n    return checked_event_forwarding(handler_{i}.{call});'
                                .format(i=i, call=call_text) for i in range(len(self.members_info)))
@@ -301,11 +683,140 @@ class HelperClassCodeGenerator(object):
     def writer_type_name(self):
         return "Writer" + hashlib.sha256(self.class_info.qualified_name.encode()).hexdigest()
 
+    @staticmethod
+    def key_token(member_info, index):
+        token = json_string_token(member_info.json_key) + b':'
+        return b',' + token if index > 0 else token
+
+    def value_serializer(self, m):
+        if m.precision is not None:
+            return 'FixedPointSerializer< {} >({}, {})'.format(self.writer_type_name(), m.precision,
+                                                                'true' if m.fixed else 'false')
+        return 'Serializer< {}, {} >()'.format(self.writer_type_name(), m.type_name)
+
     def data_serialization(self):
-        return '\n'.join('w.Key({}, {}, false); Serializer< {}, {} >()(w, value.{});'
-                             .format(cstring_literal(m.json_key), len(m.json_key),
-                                     self.writer_type_name(), m.type_name, m.variable_name)
-                         for m in self.members_info)
+        if self.class_info.positional:
+            return '\n'.join('{serializer}(w, value.{name});'.format(serializer=self.value_serializer(m),
+                                                                     name=m.variable_name)
+                              for m in self.members_info)
+        return '\n'.join('KeyWriter< {writer} >()(w, {key}, {key_length}, {token}, {token_length});\n'
+                          '{serializer}(w, value.{name});'
+                              .format(writer=self.writer_type_name(),
+                                      key=cstring_literal(m.json_key), key_length=len(m.json_key),
+                                      token=cstring_literal(self.key_token(m, i)),
+                                      token_length=len(self.key_token(m, i)),
+                                      serializer=self.value_serializer(m), name=m.variable_name)
+                          for i, m in enumerate(self.members_info))
+
+    # members are tagged by their position in the definition, starting from 1 as in protobuf
+    def binary_field_writing(self):
+        return '\n'.join('out.put_tag({id}, BinaryCodec< {type} >::wire_type);\n'
+                         'BinaryCodec< {type} >::write(out, value.{name});'
+                             .format(id=i + 1, type=m.type_name, name=m.variable_name)
+                         for i, m in enumerate(self.members_info))
+
+    def binary_field_reading(self):
+        return '\n'.join('case {id}:\n'
+                         '    if (wire_type != BinaryCodec< {type} >::wire_type\n'
+                         '        || !BinaryCodec< {type} >::read(in, value.{name}))\n'
+                         '        return false;\n'
+                         '    break;'
+                             .format(id=i + 1, type=m.type_name, name=m.variable_name)
+                         for i, m in enumerate(self.members_info))
+
+    # every member has an eight byte slot in the table of the class, in the order of definition
+    def snapshot_accessors(self):
+        return '\n\n'.join('SnapshotTraits< {type} >::view_type {name}() const\n'
+                            '{{\n'
+                            '    return SnapshotTraits< {type} >::view(m_region, m_table + {i} * snapshot::slot_size);\n'
+                            '}}'
+                                .format(i=i, type=m.type_name, name=m.variable_name)
+                            for i, m in enumerate(self.members_info))
+
+    def snapshot_slot_writing(self):
+        return '\n'.join('SnapshotTraits< {type} >::write(builder, table + {i} * snapshot::slot_size, value.{name});'
+                             .format(i=i, type=m.type_name, name=m.variable_name)
+                         for i, m in enumerate(self.members_info))
+
+    def constrained_members(self):
+        return [(i, m) for i, m in enumerate(self.members_info) if m.has_constraints]
+
+    # the object is only needed to check the constraints on complete members
+    def object_declaration(self):
+        return '\n{} * object;'.format(self.class_info.qualified_name) if self.constrained_members() else ''
+
+    def object_initializer(self):
+        return '\n, object(obj)' if self.constrained_members() else ''
+
+    @staticmethod
+    def constraint_checks(m):
+        value = 'object->' + m.variable_name
+        checks = []
+
+        def check(condition, error, *args):
+            checks.append('if ({}) {{\n    the_error.set<error::{}>({});\n    return false;\n}}'
+                          .format(condition, error, ', '.join(('"{}"'.format(m.variable_name),) + args)))
+
+        # an unsigned value is never below a minimum of zero
+        def size_check(variable, expression, minimum, maximum, error):
+            conditions = []
+            if minimum:
+                conditions.append('{} < {}'.format(variable, minimum))
+            if maximum is not None:
+                conditions.append('{} > {}'.format(variable, maximum))
+            if conditions:
+                checks.append('std::size_t {} = {};'.format(variable, expression))
+                check(' || '.join(conditions), error, variable, str(minimum or 0),
+                      'validation::npos' if maximum is None else str(maximum))
+
+        size_check('length', 'validation::string_length({})'.format(value),
+                   m.option('minLength'), m.option('maxLength'), 'StringLengthError')
+
+        if m.option('pattern') is not None:
+            pattern = cstring_literal(m.option('pattern').encode('utf-8'))
+            checks.append('static const validation::Pattern pattern({});'.format(pattern))
+            check('!pattern.search({})'.format(value), 'PatternMismatchError', pattern)
+
+        enum = m.option('enum')
+        if enum is not None and isinstance(enum[0], str):
+            keys = []
+            for v in enum:
+                if v.encode('utf-8') not in keys:
+                    keys.append(v.encode('utf-8'))
+            seed, table = perfect_hash_table(keys)
+            checks.append('static const char* const enum_table[] = {{ {} }};'
+                          .format(', '.join('0' if k is None else cstring_literal(k) for k in table)))
+            checks.append('static const std::size_t enum_lengths[] = {{ {} }};'
+                          .format(', '.join('0' if k is None else str(len(k)) for k in table)))
+            check('!validation::in_string_set({}, enum_table, enum_lengths, {}u, {}u)'
+                  .format(value, seed, len(table) - 1), 'EnumMismatchError',
+                  'error::ErrorText({0}.data(), {0}.size())'.format(value))
+        elif enum is not None:
+            check(' && '.join('{} != {!r}'.format(value, float(v)) for v in enum), 'EnumMismatchError')
+
+        minimum, maximum = m.option('minimum'), m.option('maximum')
+        if minimum is not None or maximum is not None:
+            conditions = []
+            if minimum is not None:
+                conditions.append('{} < {!r}'.format(value, float(minimum)))
+            if maximum is not None:
+                conditions.append('{} > {!r}'.format(value, float(maximum)))
+            check(' || '.join(conditions), 'ValueOutOfBoundsError', 'static_cast<double>({})'.format(value),
+                  '-std::numeric_limits<double>::infinity()' if minimum is None else repr(float(minimum)),
+                  'std::numeric_limits<double>::infinity()' if maximum is None else repr(float(maximum)))
+
+        size_check('item_count', '{}.size()'.format(value),
+                   m.option('minItems'), m.option('maxItems'), 'ItemCountError')
+
+        if m.option('uniqueItems'):
+            checks.append('std::size_t duplicate = validation::find_duplicate({});'.format(value))
+            check('duplicate != validation::npos', 'DuplicateItemsError', 'duplicate')
+
+        return '\n'.join(checks)
+
+    def member_validation(self):
+        return '\n\n'.join('case {}: {{\n{}\n    break;\n}}'.format(i, self.constraint_checks(m))
+                            for i, m in self.constrained_members())
 
     def current_member_name(self):
         return '\n'.join('case {}:\n    return "{}";'.format(i, m.variable_name)
@@ -313,23 +824,32 @@ class HelperClassCodeGenerator(object):
 
     def unknown_key_handling(self):
         if self.class_info.strict_parsing:
-            return 'the_error.reset(new error::UnknownFieldError(str, length)); return false;'
+            return 'the_error.set<error::UnknownFieldError>(unknown_key.keep(str, length));\n' \
+                   'return false;'
         else:
             return 'return true;'
 
+    # elements past the last member of a positional class are unknown fields
+    def extra_member_handling(self):
+        if self.class_info.strict_parsing:
+            return 'the_error.set<error::ArrayLengthMismatchError>({}, static_cast<std::size_t>(index) + 1);\n' \
+                   'return false;'.format(self.count_of_members())
+        else:
+            return 'break;'
+
     def count_of_members(self):
         return str(len(self.members_info))
 
-    def flag_statement(self, member_info, flag):
+    def flag_setting(self, member_info):
         if self.class_info.no_duplicates or member_info.is_required:
-            return 'has_{} = {};'.format(member_info.variable_name, flag)
+            return 'has_flags[{}] |= 0x{:x}ULL;'.format(*self.flag_bit(member_info))
         else:
             return ''
 
     def check_for_duplicate_key(self, member_info):
         if self.class_info.no_duplicates:
-            return 'if (has_{}) the_error.reset(new error::DuplicateKeyError(current_member_name()));\n'.\
-                format(member_info.variable_name)
+            return 'if (has_flags[{}] & 0x{:x}ULL) the_error.set<error::DuplicateKeyError>(current_member_name());\n'.\
+                format(*self.flag_bit(member_info))
         else:
             return ''
 
@@ -362,6 +882,12 @@ class CPPTypeNameChecker(object):
                                         'std::uint64_t', 'std::int64_t', 'uint32_t', 'int32_t', 'uint64_t', 'int64_t',
                                         'std::nullptr_t',
                                         'std::size_t', 'size_t', 'std::ptrdiff_t', 'ptrdiff_t',
+                                        'signed char', 'unsigned char', 'short', 'unsigned short',
+                                        'std::int8_t', 'std::uint8_t', 'std::int16_t', 'std::uint16_t',
+                                        'int8_t', 'uint8_t', 'int16_t', 'uint16_t', 'float',
+                                        'autojsoncxx::uuid', 'autojsoncxx::ipv4_address', 'autojsoncxx::ipv6_address',
+                                        'autojsoncxx::bytes',
+                                        'std::chrono::system_clock::time_point',
                                         'double', 'std::string', 'std::vector', 'std::deque', 'std::array',
                                         'boost::container::vector', 'boost::container::deque', 'boost::array',
                                         'std::shared_ptr', 'std::unique_ptr', 'boost::shared_ptr', 'boost::optional',
@@ -401,24 +927,185 @@ class CPPTypeNameChecker(object):
         return self._known_names
 
 
-def build_class(template, class_info):
+# the types known not to be written as JSON objects, by the name before any template arguments
+NON_OBJECT_TYPE_NAMES = frozenset(['bool', 'char', 'int', 'unsigned int', 'unsigned', 'long long', 'long long int',
+                                   'unsigned long long', 'unsigned long long int', 'std::uint32_t', 'std::int32_t',
+                                   'std::uint64_t', 'std::int64_t', 'uint32_t', 'int32_t', 'uint64_t', 'int64_t',
+                                   'std::size_t', 'size_t', 'std::ptrdiff_t', 'ptrdiff_t', 'std::nullptr_t',
+                                   'signed char', 'unsigned char', 'short', 'unsigned short',
+                                   'std::int8_t', 'std::uint8_t', 'std::int16_t', 'std::uint16_t',
+                                   'int8_t', 'uint8_t', 'int16_t', 'uint16_t', 'float', 'double', 'std::string',
+                                   'std::vector', 'std::deque', 'std::array', 'std::tuple',
+                                   'boost::container::vector', 'boost::container::deque', 'boost::array',
+                                   'std::shared_ptr', 'std::unique_ptr', 'boost::shared_ptr', 'boost::optional',
+                                   'std::optional', 'std::variant', 'autojsoncxx::uuid', 'autojsoncxx::ipv4_address',
+                                   'autojsoncxx::ipv6_address', 'autojsoncxx::bytes',
+                                   'std::chrono::system_clock::time_point', 'std::chrono::time_point'])
+
+
+# the discriminator is added to the object of the alternative, so alternatives that are not written
+# as objects, such as numbers, arrays, positional classes and enums, cannot be told apart when parsed.
+# Types not declared in the definition file nor known here are left to the compiler.
+def check_union_alternatives(infos):
+    declared = dict((info.qualified_name.lstrip(':'), info) for info in infos)
+    for info in infos:
+        if not isinstance(info, UnionInfo):
+            continue
+        for alternative in info.alternatives:
+            type_name = alternative.type_name.strip().lstrip(':')
+            head = re.sub(r'\s+', ' ', type_name.split('<')[0]).strip()
+            target = declared.get(type_name)
+            if head in NON_OBJECT_TYPE_NAMES or isinstance(target, EnumInfo) or (
+                        isinstance(target, ClassInfo) and target.positional):
+                raise UnsupportedTypeError(alternative.type_name)
+
+
+# Fingerprints of the binary layout of every class: the class name and the field ids and types of
+# its members, folding in the layouts of the classes and the spellings of the enums it uses
+# from the same definition file
+def schema_fingerprints(class_infos):
+    by_name = dict((c.qualified_name, c) for c in class_infos)
+    results = {}
+
+    def referenced_classes(class_info, type_name):
+        scopes = (class_info.namespace or '').strip(':').split('::')
+        for token in re.findall(r'(?:::)?[A-Za-z_]\w*(?:::[A-Za-z_]\w*)*', type_name):
+            if token.startswith('::'):
+                candidates = [token]
+            else:
+                candidates = ['::' + '::'.join([s for s in scopes[:n] if s] + [token])
+                              for n in range(len(scopes), -1, -1)]
+            for c in candidates:
+                if c in by_name:
+                    yield c
+                    break
+
+    def compute(class_info, visiting):
+        name = class_info.qualified_name
+        if name in results:
+            return results[name]
+        digest = hashlib.sha256(name.encode('utf-8'))
+        if isinstance(class_info, EnumInfo):
+            for e in class_info.enumerators:
+                digest.update(b'|' + e[1])
+            results[name] = '0x' + digest.hexdigest()[:16] + 'ULL'
+            return results[name]
+        if isinstance(class_info, UnionInfo):
+            digest.update(b'|' + class_info.discriminator)
+            for a in class_info.alternatives:
+                digest.update(b'|' + a.tag)
+        for i, m in enumerate(class_info.members):
+            type_name = re.sub(r'\s+', ' ', m.type_name.strip())
+            digest.update('|{}:{}'.format(i + 1, type_name).encode('utf-8'))
+            for ref in referenced_classes(class_info, m.type_name):
+                if ref in visiting or ref == name:
+                    digest.update(ref.encode('utf-8'))
+                else:
+                    digest.update(compute(by_name[ref], visiting | {name}).encode('utf-8'))
+        results[name] = '0x' + digest.hexdigest()[:16] + 'ULL'
+        return results[name]
+
+    for c in class_infos:
+        compute(c, frozenset())
+    return results
+
+
+def build_enum(template, enum_info):
+    template = re.search(r'/\*\s*begin enum\s*\*/\n(.*?)/\*\s*end enum\s*\*/\n', template, flags=re.DOTALL).group(1)
+    spellings = [e[1] for e in enum_info.enumerators]
+    seed, table = perfect_hash_table(spellings)
+
+    replacement = {
+        "enum definition": enum_info.enum_definition(),
+        "TypeName": enum_info.qualified_name,
+        "enum name literal": '"{}"'.format(enum_info.qualified_name),
+        "count of enumerators": str(len(spellings)),
+        "list of spellings": ',\n'.join('{{ {}, {}, {}, {} }}'.format(cstring_literal(s), len(s),
+                                                                     cstring_literal(json_string_token(s)),
+                                                                     len(json_string_token(s)))
+                                        for s in spellings),
+        "hash slots": ', '.join('-1' if s is None else str(spellings.index(s)) for s in table),
+        "hash seed": '{}u'.format(seed),
+        "hash mask": '{}u'.format(len(table) - 1)
+    }
+    return re.sub(r'/\*\s*(.*?)\s*\*/', lambda match: replacement[match.group(1)], template)
+
+
+def build_union(template, union_info):
+    template = re.search(r'/\*\s*begin union\s*\*/\n(.*?)/\*\s*end union\s*\*/\n', template, flags=re.DOTALL).group(1)
+    tags = [a.tag for a in union_info.alternatives]
+    seed, table = perfect_hash_table(tags)
+
+    def spelling(byte_string, token):
+        return '{{ {}, {}, {}, {} }}'.format(cstring_literal(byte_string), len(byte_string),
+                                            cstring_literal(token), len(token))
+
+    replacement = {
+        "union definition": union_info.union_definition(),
+        "TypeName": union_info.qualified_name,
+        "union name literal": '"{}"'.format(union_info.qualified_name),
+        "discriminator spelling": spelling(union_info.discriminator,
+                                           json_string_token(union_info.discriminator) + b':'),
+        "count of alternatives": str(len(tags)),
+        "list of tags": ',\n'.join(spelling(t, json_string_token(t)) for t in tags),
+        "hash slots": ', '.join('-1' if t is None else str(tags.index(t)) for t in table),
+        "hash seed": '{}u'.format(seed),
+        "hash mask": '{}u'.format(len(table) - 1),
+        "alternative handler declarations": '\n'.join(
+            'internal::ErasedSAXEventHandler< {} > handler_{};'.format(a.type_name, i)
+            for i, a in enumerate(union_info.alternatives)),
+        "alternative handler init": '\n'.join(
+            ', handler_{}(&obj->{})'.format(i, a.variable_name) for i, a in enumerate(union_info.alternatives)),
+        "select alternative": '\n'.join(
+            'case {}:\n m_value->tag = {};\n return &handler_{};'.format(i, union_info.tag_enumerator(a), i)
+            for i, a in enumerate(union_info.alternatives)),
+        "write alternatives": '\n'.join(
+            'case {}:\n write_alternative(w, traits::discriminator(), traits::tags()[{}], value.{});\n break;'
+            .format(union_info.tag_enumerator(a), i, a.variable_name)
+            for i, a in enumerate(union_info.alternatives))
+    }
+    return re.sub(r'/\*\s*(.*?)\s*\*/', lambda match: replacement[match.group(1)], template)
+
+
+def build_class(template, class_info, fingerprint, snapshot=False):
     gen = HelperClassCodeGenerator(class_info)
 
+    template = re.sub(r'/\*\s*begin enum\s*\*/\n.*?/\*\s*end enum\s*\*/\n', '', template, flags=re.DOTALL)
+    template = re.sub(r'/\*\s*begin union\s*\*/\n.*?/\*\s*end union\s*\*/\n', '', template, flags=re.DOTALL)
+
+    template = re.sub(r'/\*\s*begin positional\s*\*/\n(.*?)/\*\s*end positional\s*\*/\n',
+                      lambda match: match.group(1) if class_info.positional else '', template, flags=re.DOTALL)
+    template = re.sub(r'/\*\s*begin snapshot\s*\*/\n(.*?)/\*\s*end snapshot\s*\*/\n',
+                      lambda match: match.group(1) if snapshot else '', template, flags=re.DOTALL)
+
     replacement = {
         "class definition": ClassDefinitionCodeGenerator(class_info).class_definition(),
-        "list of declarations": gen.handler_declarations() + gen.flags_declaration(),
-        "init": gen.handler_initializers(),
+        "list of declarations": gen.handler_declarations() + gen.flags_declaration() + gen.unknown_key_declaration()
+                                + gen.object_declaration(),
+        "init": gen.handler_initializers() + gen.object_initializer(),
+        "validate members": gen.member_validation(),
         "serialize all members": gen.data_serialization(),
+        "handler name": 'MembersSAXEventHandler' if class_info.positional else 'SAXEventHandler',
         "change state": gen.key_event_handling(),
+        "select member": gen.member_selection(),
+        "handle extra member": gen.extra_member_handling(),
         "reap error": gen.error_reaping(),
         "get member name": gen.current_member_name(),
         "validation": gen.post_validation(),
+        "list missing members": gen.missing_members_listing(),
         "reset flags": gen.flags_reset(),
         "handle unknown key": gen.unknown_key_handling(),
         "TypeName": class_info.qualified_name,
         "count of members": gen.count_of_members(),
+        "container": 'array' if class_info.positional else 'object',
+        "end container": 'EndArray' if class_info.positional else 'EndObject',
         "Writer": gen.writer_type_name(),
-        "call PrepareForReuse": gen.prepare_for_reuse()
+        "call PrepareForReuse": gen.prepare_for_reuse(),
+        "binary fingerprint": fingerprint,
+        "write all fields": gen.binary_field_writing(),
+        "read all fields": gen.binary_field_reading(),
+        "snapshot accessors": gen.snapshot_accessors(),
+        "write all slots": gen.snapshot_slot_writing()
     }
 
     def evaluate(match):
@@ -458,6 +1145,8 @@ def main():
     parser.add_argument('-i', '--input', help='input name for the definition file for classes', required=True)
     parser.add_argument('-o', '--output', help='output name for the header file', default=None)
     parser.add_argument('--template', help='location of the template file', default=None)
+    parser.add_argument('--snapshot', help='also generate the views of classes in memory-mappable snapshots',
+                        action='store_true', default=False)
     args = parser.parse_args()
 
     if args.check and not parsimonious:
@@ -502,18 +1191,28 @@ def main():
     with io.open(args.output, 'w', encoding='utf-8') as output:
         output.write('#pragma once\n\n')
 
-        def output_class(class_record):
-            class_info = ClassInfo(class_record)
-            if args.check:
-                warn_if_name_unknown(checker, class_info)
-            output.write(build_class(template, class_info))
+        records = raw_record if isinstance(raw_record, list) else [raw_record]
+        infos = [EnumInfo(r) if 'enumerators' in r else UnionInfo(r) if 'oneOf' in r else ClassInfo(r)
+                 for r in records]
+        check_union_alternatives(infos)
+        fingerprints = schema_fingerprints(infos)
 
-        if isinstance(raw_record, list):
-            for r in raw_record:
+        for r, info in zip(records, infos):
+            if isinstance(raw_record, list):
                 print("Processing:", r)
-                output_class(r)
-        else:
-            output_class(raw_record)
+            if isinstance(info, EnumInfo):
+                if args.check:
+                    checker.known_names.add(info.qualified_name.lstrip(':'))
+                output.write(build_enum(template, info))
+                continue
+            if isinstance(info, UnionInfo):
+                if args.check:
+                    warn_if_name_unknown(checker, info)
+                output.write(build_union(template, info))
+                continue
+            if args.check:
+                warn_if_name_unknown(checker, info)
+            output.write(build_class(template, info, fingerprints[info.qualified_name], args.snapshot))
 
 
 if __name__ == '__main__':
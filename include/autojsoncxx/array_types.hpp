@@ -38,12 +38,12 @@
 
 namespace autojsoncxx {
 
-template <class ElementType, class Derived>
+template <class ElementType, class Derived, bool = utility::traits::is_arithmetic_type<ElementType>::value>
 class VectorBaseSAXEventHandler {
 private:
     ElementType current;
     SAXEventHandler<ElementType> internal_handler;
-    utility::scoped_ptr<error::ErrorBase> the_error;
+    error::ErrorHolder the_error;
     utility::stack<signed char, 32> state;
     // A stack of StartArray() and StartObject() event
     // must be recorded, so we know when the current
@@ -63,7 +63,7 @@ private:
     {
         if (state.size() == 1 && state.top() == internal::ARRAY
             && !static_cast<Derived*>(this)->CheckLength(length)) {
-            this->the_error.reset(new error::ArrayLengthMismatchError(static_cast<Derived*>(this)->ExpectedLength(), length));
+            the_error.set<error::ArrayLengthMismatchError>(static_cast<Derived*>(this)->ExpectedLength(), length);
             return false;
         }
         return true;
@@ -72,7 +72,7 @@ private:
     bool check_depth(const char* type)
     {
         if (state.empty()) {
-            the_error.reset(new error::TypeMismatchError("array", type));
+            the_error.set<error::TypeMismatchError>("array", type);
             return false;
         }
         return true;
@@ -91,7 +91,7 @@ private:
 
     void set_element_error()
     {
-        this->the_error.reset(new error::ArrayElementError(static_cast<Derived*>(this)->GetCurrentSize()));
+        the_error.set<error::ArrayElementError>(static_cast<Derived*>(this)->GetCurrentSize());
     }
 
 public:
@@ -202,7 +202,7 @@ public:
         if (this->the_error.empty())
             return false;
 
-        errs.push(this->the_error.release());
+        the_error.move_to(errs);
         internal_handler.ReapError(errs);
         return true;
     }
@@ -215,6 +215,148 @@ public:
     }
 };
 
+// Elements of arithmetic types cannot contain nested arrays or objects, so one flag replaces the stack of states.
+// Each scalar event is converted by the element handler and appended right away;
+// the element is overwritten by the next event, so it never needs resetting.
+template <class ElementType, class Derived>
+class VectorBaseSAXEventHandler<ElementType, Derived, true> {
+private:
+    ElementType current;
+    SAXEventHandler<ElementType> internal_handler;
+    error::ErrorHolder the_error;
+    bool in_array;
+
+    bool check_depth(const char* type)
+    {
+        if (!in_array) {
+            the_error.set<error::TypeMismatchError>("array", type);
+            return false;
+        }
+        return true;
+    }
+
+    bool push_if_converted(bool success)
+    {
+        if (success) {
+            static_cast<Derived*>(this)->Push(current);
+            return true;
+        }
+
+        set_element_error();
+        return false;
+    }
+
+    void set_element_error()
+    {
+        the_error.set<error::ArrayElementError>(static_cast<Derived*>(this)->GetCurrentSize());
+    }
+
+public:
+    explicit VectorBaseSAXEventHandler()
+        : current()
+        , internal_handler(&current)
+        , in_array(false)
+    {
+    }
+
+    bool Null()
+    {
+        return check_depth("null") && push_if_converted(internal_handler.Null());
+    }
+
+    bool Bool(bool b)
+    {
+        return check_depth("bool") && push_if_converted(internal_handler.Bool(b));
+    }
+
+    bool Int(int i)
+    {
+        return check_depth("int") && push_if_converted(internal_handler.Int(i));
+    }
+
+    bool Uint(unsigned i)
+    {
+        return check_depth("unsigned") && push_if_converted(internal_handler.Uint(i));
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        return check_depth("int64_t") && push_if_converted(internal_handler.Int64(i));
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        return check_depth("uint64_t") && push_if_converted(internal_handler.Uint64(i));
+    }
+
+    bool Double(double d)
+    {
+        return check_depth("double") && push_if_converted(internal_handler.Double(d));
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        return check_depth("string") && push_if_converted(internal_handler.String(str, length, copy));
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        return check_depth("object") && push_if_converted(internal_handler.Key(str, length, copy));
+    }
+
+    bool StartArray()
+    {
+        if (!in_array) {
+            in_array = true;
+            return true;
+        }
+        return push_if_converted(internal_handler.StartArray());
+    }
+
+    bool EndArray(SizeType length)
+    {
+        assert(in_array);
+        if (!static_cast<Derived*>(this)->CheckLength(length)) {
+            the_error.set<error::ArrayLengthMismatchError>(static_cast<Derived*>(this)->ExpectedLength(), length);
+            return false;
+        }
+        in_array = false;
+        return true;
+    }
+
+    bool StartObject()
+    {
+        return check_depth("object") && push_if_converted(internal_handler.StartObject());
+    }
+
+    bool EndObject(SizeType length)
+    {
+        return check_depth("object") && push_if_converted(internal_handler.EndObject(length));
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        the_error.move_to(errs);
+        internal_handler.ReapError(errs);
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        the_error.reset();
+        in_array = false;
+        internal_handler.PrepareForReuse();
+    }
+};
+
 template <class T, class Allocator>
 class SAXEventHandler<std::vector<T, Allocator> >
     : public VectorBaseSAXEventHandler<T, SAXEventHandler<std::vector<T, Allocator> > > {
@@ -313,10 +455,11 @@ template <class Writer, class Container, class ValueType, class ConstIteratorTyp
 struct ContainerSerializer {
     void operator()(Writer& w, const Container& con) const
     {
-        w.StartArray();
+        SizeType size = static_cast<SizeType>(std::distance(con.begin(), con.end()));
+        ContainerStarter<Writer>::array(w, size);
         for (ConstIteratorType it = con.begin(), end = con.end(); it != end; ++it)
             Serializer<Writer, ValueType>()(w, *it);
-        w.EndArray(static_cast<SizeType>(std::distance(con.begin(), con.end())));
+        w.EndArray(size);
     }
 };
 
@@ -327,6 +470,47 @@ struct Serializer<Writer, std::vector<T, Allocator> >
                                  typename std::vector<T, Allocator>::const_iterator> {
 };
 
+// Doubles are formatted into a local buffer, and each full buffer is handed to the writer at once
+template <class Writer, class Container, bool = utility::traits::accepts_raw_numbers<Writer>::value>
+struct DoubleContainerSerializer
+    : public ContainerSerializer<Writer, Container, double, typename Container::const_iterator> {
+};
+
+template <class Writer, class Container>
+struct DoubleContainerSerializer<Writer, Container, true> {
+    void operator()(Writer& w, const Container& con) const
+    {
+        char chunk[4096];
+        std::size_t length = 0;
+        SizeType count = 0;
+
+        w.StartArray();
+        for (typename Container::const_iterator it = con.begin(), end = con.end(); it != end; ++it) {
+            if (count > 0 && (length + utility::max_double_length + 1 > sizeof(chunk) || !utility::is_finite(*it))) {
+                w.RawNumbers(chunk, static_cast<SizeType>(length), count);
+                length = 0;
+                count = 0;
+            }
+            if (!utility::is_finite(*it)) {
+                w.Double(*it);
+                continue;
+            }
+            if (count > 0)
+                chunk[length++] = ',';
+            length = static_cast<std::size_t>(utility::format_double(chunk + length, *it) - chunk);
+            ++count;
+        }
+        if (count > 0)
+            w.RawNumbers(chunk, static_cast<SizeType>(length), count);
+        w.EndArray(static_cast<SizeType>(con.size()));
+    }
+};
+
+template <class Writer, class Allocator>
+struct Serializer<Writer, std::vector<double, Allocator> >
+    : public DoubleContainerSerializer<Writer, std::vector<double, Allocator> > {
+};
+
 template <class Writer, class T, class Allocator>
 struct Serializer<Writer, std::deque<T, Allocator> >
     : public ContainerSerializer<Writer, std::deque<T, Allocator>,
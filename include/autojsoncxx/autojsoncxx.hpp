@@ -26,15 +26,31 @@
 #include <autojsoncxx/utility.hpp>
 #include <autojsoncxx/base.hpp>
 #include <autojsoncxx/error.hpp>
+#include <autojsoncxx/validation.hpp>
 #include <autojsoncxx/array_types.hpp>
 #include <autojsoncxx/nullable_types.hpp>
 #include <autojsoncxx/tuple_types.hpp>
 #include <autojsoncxx/map_types.hpp>
+#include <autojsoncxx/enum_types.hpp>
+#include <autojsoncxx/format_types.hpp>
+#include <autojsoncxx/tagged_union.hpp>
+#include <autojsoncxx/variant_types.hpp>
 #include <autojsoncxx/to_json.hpp>
 #include <autojsoncxx/from_json.hpp>
 #include <autojsoncxx/dom.hpp>
+#include <autojsoncxx/fingerprint.hpp>
+#include <autojsoncxx/msgpack.hpp>
+#include <autojsoncxx/cbor.hpp>
+#include <autojsoncxx/binary.hpp>
+#include <autojsoncxx/snapshot.hpp>
 #ifdef AUTOJSONCXX_ENABLE_BOOST_TYPES
 #include <autojsoncxx/boost_types.hpp>
 #endif
+#ifdef AUTOJSONCXX_ENABLE_POSIX_STREAMS
+#include <autojsoncxx/posix_streams.hpp>
+#endif
+#ifdef AUTOJSONCXX_ENABLE_FAST_NUMBERS
+#include <autojsoncxx/fast_numbers.hpp>
+#endif
 
 #endif
@@ -25,6 +25,7 @@
 
 #include <autojsoncxx/utility.hpp>
 #include <autojsoncxx/error.hpp>
+#include <autojsoncxx/number_format.hpp>
 
 #include <string>
 #include <cstring>
@@ -43,7 +44,7 @@ class SAXEventHandler;
 template <class Derived, class Ch = char>
 class BaseSAXEventHandler {
 protected:
-    utility::scoped_ptr<error::ErrorBase> the_error;
+    error::ErrorHolder the_error;
 
 public:
     static const char* type_name()
@@ -54,13 +55,13 @@ public:
 protected:
     bool set_out_of_range(const char* actual_type)
     {
-        the_error.reset(new error::NumberOutOfRangeError(type_name(), actual_type));
+        the_error.set<error::NumberOutOfRangeError>(type_name(), actual_type);
         return false;
     }
 
     bool set_type_mismatch(const char* actual_type)
     {
-        the_error.reset(new error::TypeMismatchError(type_name(), actual_type));
+        the_error.set<error::TypeMismatchError>(type_name(), actual_type);
         return false;
     }
 
@@ -139,7 +140,7 @@ public:
     {
         if (the_error.empty())
             return false;
-        errs.push(the_error.release());
+        the_error.move_to(errs);
         return true;
     }
 
@@ -315,6 +316,112 @@ public:
     }
 };
 
+// Integers narrower than `int`, which keep objects small. Every value is checked against the limits of the type.
+template <class Integer, class Derived>
+class NarrowIntegerSAXEventHandler : public BaseSAXEventHandler<Derived> {
+private:
+    Integer* m_value;
+
+    bool store(utility::int64_t i, const char* actual_type)
+    {
+        if (i < static_cast<utility::int64_t>(std::numeric_limits<Integer>::min())
+            || i > static_cast<utility::int64_t>(std::numeric_limits<Integer>::max()))
+            return this->set_out_of_range(actual_type);
+        *m_value = static_cast<Integer>(i);
+        return true;
+    }
+
+protected:
+    explicit NarrowIntegerSAXEventHandler(Integer* v)
+        : m_value(v)
+    {
+    }
+
+public:
+    bool Int(int i)
+    {
+        return store(i, "int");
+    }
+
+    bool Uint(unsigned i)
+    {
+        return store(i, "unsigned");
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        return store(i, "int64_t");
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (i > static_cast<utility::uint64_t>(std::numeric_limits<Integer>::max()))
+            return this->set_out_of_range("uint64_t");
+        *m_value = static_cast<Integer>(i);
+        return true;
+    }
+};
+
+template <>
+class SAXEventHandler<utility::int8_t>
+    : public NarrowIntegerSAXEventHandler<utility::int8_t, SAXEventHandler<utility::int8_t> > {
+public:
+    explicit SAXEventHandler(utility::int8_t* v)
+        : NarrowIntegerSAXEventHandler<utility::int8_t, SAXEventHandler<utility::int8_t> >(v)
+    {
+    }
+
+    static const char* type_name()
+    {
+        return "int8_t";
+    }
+};
+
+template <>
+class SAXEventHandler<utility::uint8_t>
+    : public NarrowIntegerSAXEventHandler<utility::uint8_t, SAXEventHandler<utility::uint8_t> > {
+public:
+    explicit SAXEventHandler(utility::uint8_t* v)
+        : NarrowIntegerSAXEventHandler<utility::uint8_t, SAXEventHandler<utility::uint8_t> >(v)
+    {
+    }
+
+    static const char* type_name()
+    {
+        return "uint8_t";
+    }
+};
+
+template <>
+class SAXEventHandler<utility::int16_t>
+    : public NarrowIntegerSAXEventHandler<utility::int16_t, SAXEventHandler<utility::int16_t> > {
+public:
+    explicit SAXEventHandler(utility::int16_t* v)
+        : NarrowIntegerSAXEventHandler<utility::int16_t, SAXEventHandler<utility::int16_t> >(v)
+    {
+    }
+
+    static const char* type_name()
+    {
+        return "int16_t";
+    }
+};
+
+template <>
+class SAXEventHandler<utility::uint16_t>
+    : public NarrowIntegerSAXEventHandler<utility::uint16_t, SAXEventHandler<utility::uint16_t> > {
+public:
+    explicit SAXEventHandler(utility::uint16_t* v)
+        : NarrowIntegerSAXEventHandler<utility::uint16_t, SAXEventHandler<utility::uint16_t> >(v)
+    {
+    }
+
+    static const char* type_name()
+    {
+        return "uint16_t";
+    }
+};
+
 template <>
 class SAXEventHandler<utility::int64_t> : public BaseSAXEventHandler<SAXEventHandler<utility::int64_t> > {
 private:
@@ -459,6 +566,62 @@ public:
     }
 };
 
+template <>
+class SAXEventHandler<float> : public BaseSAXEventHandler<SAXEventHandler<float> > {
+private:
+    float* m_value;
+
+    // Integers beyond 2^24 would lose precision, like those beyond 2^53 for `double`
+    bool store_integer(double d, const char* actual_type)
+    {
+        const double threshold = 16777216.0;
+        if (d > threshold || d < -threshold)
+            return this->set_out_of_range(actual_type);
+        *m_value = static_cast<float>(d);
+        return true;
+    }
+
+public:
+    explicit SAXEventHandler(float* v)
+        : m_value(v)
+    {
+    }
+
+    bool Int(int i)
+    {
+        return store_integer(i, "int");
+    }
+
+    bool Uint(unsigned i)
+    {
+        return store_integer(i, "unsigned");
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        return store_integer(static_cast<double>(i), "int64_t");
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        return store_integer(static_cast<double>(i), "uint64_t");
+    }
+
+    // Infinities and NaN are kept, as by `double`; only finite values can overflow
+    bool Double(double d)
+    {
+        if (utility::is_finite(d) && (d > std::numeric_limits<float>::max() || d < -std::numeric_limits<float>::max()))
+            return this->set_out_of_range("double");
+        *m_value = static_cast<float>(d);
+        return true;
+    }
+
+    static const char* type_name()
+    {
+        return "float";
+    }
+};
+
 template <>
 class SAXEventHandler<std::string> : public BaseSAXEventHandler<SAXEventHandler<std::string> > {
 private:
@@ -482,9 +645,255 @@ public:
     }
 };
 
+// The generated handler of a class with positional encoding, which still expects its members by key
+template <class T>
+class MembersSAXEventHandler;
+
+// Parses a class with positional encoding, written as an array of its members in order.
+// Each element at the top level selects the next member by index, so that no keys are compared,
+// and the members handler validates the result as if it had read an object.
+template <class T>
+class PositionalSAXEventHandler {
+private:
+    error::ErrorHolder the_error;
+    MembersSAXEventHandler<T> m_members;
+    int m_depth;
+    int m_index;
+
+    bool start_value(const char* type)
+    {
+        if (m_depth <= 0) {
+            the_error.set<error::TypeMismatchError>("array", type);
+            return false;
+        }
+        if (m_depth == 1)
+            return m_members.SelectMember(++m_index);
+        return true;
+    }
+
+public:
+    explicit PositionalSAXEventHandler(T* obj)
+        : m_members(obj)
+        , m_depth(0)
+        , m_index(-1)
+    {
+    }
+
+    bool Null()
+    {
+        return start_value("null") && m_members.Null();
+    }
+
+    bool Bool(bool b)
+    {
+        return start_value("bool") && m_members.Bool(b);
+    }
+
+    bool Int(int i)
+    {
+        return start_value("int") && m_members.Int(i);
+    }
+
+    bool Uint(unsigned i)
+    {
+        return start_value("unsigned") && m_members.Uint(i);
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        return start_value("int64_t") && m_members.Int64(i);
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        return start_value("uint64_t") && m_members.Uint64(i);
+    }
+
+    bool Double(double d)
+    {
+        return start_value("double") && m_members.Double(d);
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        return start_value("string") && m_members.String(str, length, copy);
+    }
+
+    // Keys only appear within the objects of members
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        return m_members.Key(str, length, copy);
+    }
+
+    bool StartArray()
+    {
+        if (m_depth == 0) {
+            ++m_depth;
+            m_index = -1;
+            return m_members.StartObject();
+        }
+        if (!start_value("array"))
+            return false;
+        ++m_depth;
+        return m_members.StartArray();
+    }
+
+    bool EndArray(SizeType length)
+    {
+        --m_depth;
+        if (m_depth == 0)
+            return m_members.EndObject(static_cast<SizeType>(m_index + 1));
+        return m_members.EndArray(length);
+    }
+
+    bool StartObject()
+    {
+        if (!start_value("object"))
+            return false;
+        ++m_depth;
+        return m_members.StartObject();
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --m_depth;
+        return m_members.EndObject(length);
+    }
+
+    bool HasError() const
+    {
+        return !the_error.empty() || m_members.HasError();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (the_error.empty())
+            return m_members.ReapError(errs);
+        the_error.move_to(errs);
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        the_error.reset();
+        m_members.PrepareForReuse();
+        m_depth = 0;
+        m_index = -1;
+    }
+};
+
 template <class Writer, class T>
 struct Serializer;
 
+// Used by the generated serializers to write the key of each member.
+// `token` is the key already quoted and escaped, followed by a colon,
+// and preceded by a comma unless it is the first member, such as `,"key":`.
+template <class Writer, bool = utility::traits::accepts_key_tokens<Writer>::value>
+struct KeyWriter {
+    void operator()(Writer& w, const char* key, SizeType key_length, const char*, SizeType) const
+    {
+        w.Key(key, key_length, false);
+    }
+};
+
+template <class Writer>
+struct KeyWriter<Writer, true> {
+    void operator()(Writer& w, const char*, SizeType, const char* token, SizeType token_length) const
+    {
+        w.KeyToken(token, token_length);
+    }
+};
+
+// Writes a string value whose token is precomputed, such as `"key"`
+template <class Writer, bool = utility::traits::accepts_string_tokens<Writer>::value>
+struct StringWriter {
+    void operator()(Writer& w, const char* str, SizeType length, const char*, SizeType) const
+    {
+        w.String(str, length, false);
+    }
+};
+
+template <class Writer>
+struct StringWriter<Writer, true> {
+    void operator()(Writer& w, const char*, SizeType, const char* token, SizeType token_length) const
+    {
+        w.StringToken(token, token_length);
+    }
+};
+
+// Starts an array or object, announcing the number of elements to writers that can use it
+template <class Writer, bool = utility::traits::accepts_container_sizes<Writer>::value>
+struct ContainerStarter {
+    static void array(Writer& w, SizeType)
+    {
+        w.StartArray();
+    }
+
+    static void object(Writer& w, SizeType)
+    {
+        w.StartObject();
+    }
+};
+
+template <class Writer>
+struct ContainerStarter<Writer, true> {
+    static void array(Writer& w, SizeType size)
+    {
+        w.StartArray(size);
+    }
+
+    static void object(Writer& w, SizeType size)
+    {
+        w.StartObject(size);
+    }
+};
+
+// Writes a double rounded to `precision` decimals, for members with the `precision` option.
+// Writers that cannot take preformatted numbers receive the rounded value instead.
+template <class Writer, bool = utility::traits::accepts_raw_numbers<Writer>::value>
+struct FixedPointSerializer {
+private:
+    int m_precision;
+
+public:
+    explicit FixedPointSerializer(int precision, bool)
+        : m_precision(precision)
+    {
+    }
+
+    void operator()(Writer& w, double d) const
+    {
+        w.Double(utility::round_to_decimals(d, m_precision));
+    }
+};
+
+template <class Writer>
+struct FixedPointSerializer<Writer, true> {
+private:
+    int m_precision;
+    bool m_fixed;
+
+public:
+    explicit FixedPointSerializer(int precision, bool fixed)
+        : m_precision(precision)
+        , m_fixed(fixed)
+    {
+    }
+
+    void operator()(Writer& w, double d) const
+    {
+        // Infinities and NaN have no decimals to fix, and are left to the writer as usual
+        if (!utility::is_finite(d)) {
+            w.Double(d);
+            return;
+        }
+
+        char buffer[utility::max_fixed_double_length];
+        char* end = utility::format_fixed_double(buffer, d, m_precision, m_fixed);
+        w.RawNumbers(buffer, static_cast<SizeType>(end - buffer), 1);
+    }
+};
+
 template <class Writer>
 struct Serializer<Writer, int> {
     void operator()(Writer& w, int i) const
@@ -529,6 +938,38 @@ struct Serializer<Writer, unsigned> {
     }
 };
 
+template <class Writer>
+struct Serializer<Writer, utility::int8_t> {
+    void operator()(Writer& w, utility::int8_t i) const
+    {
+        w.Int(i);
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, utility::uint8_t> {
+    void operator()(Writer& w, utility::uint8_t i) const
+    {
+        w.Uint(i);
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, utility::int16_t> {
+    void operator()(Writer& w, utility::int16_t i) const
+    {
+        w.Int(i);
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, utility::uint16_t> {
+    void operator()(Writer& w, utility::uint16_t i) const
+    {
+        w.Uint(i);
+    }
+};
+
 template <class Writer>
 struct Serializer<Writer, utility::int64_t> {
     void operator()(Writer& w, utility::int64_t i) const
@@ -553,6 +994,39 @@ struct Serializer<Writer, double> {
     }
 };
 
+// Writes the fewest decimals that read back as the same float, rather than all those of the double it widens to.
+// Writers that cannot take preformatted numbers receive the double nearest to those decimals.
+template <class Writer, bool = utility::traits::accepts_raw_numbers<Writer>::value>
+struct FloatSerializer {
+    void operator()(Writer& w, float f) const
+    {
+        int decimals = utility::float_decimals(f);
+        w.Double(decimals < 0 ? f : utility::round_to_decimals(f, decimals));
+    }
+};
+
+template <class Writer>
+struct FloatSerializer<Writer, true> {
+    void operator()(Writer& w, float f) const
+    {
+        // Non-finite floats are left to the writer, as are those too large or small for fixed decimals
+        int decimals = utility::is_finite(f) ? utility::float_decimals(f) : -1;
+        if (decimals < 0) {
+            w.Double(f);
+            return;
+        }
+
+        // Below 2^24, so that the shorter buffer is enough
+        char buffer[utility::max_double_length];
+        char* end = utility::format_fixed_double(buffer, f, decimals, false);
+        w.RawNumbers(buffer, static_cast<SizeType>(end - buffer), 1);
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, float> : public FloatSerializer<Writer> {
+};
+
 template <class Writer>
 struct Serializer<Writer, std::string> {
     void operator()(Writer& w, const std::string& str) const
@@ -0,0 +1,978 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef AUTOJSONCXX_BINARY_HPP_29A4C106C1B1
+#define AUTOJSONCXX_BINARY_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/array_types.hpp>
+#include <autojsoncxx/map_types.hpp>
+#include <autojsoncxx/nullable_types.hpp>
+#include <autojsoncxx/format_types.hpp>
+#include <autojsoncxx/to_json.hpp>
+#include <autojsoncxx/fingerprint.hpp>
+#include <autojsoncxx/cbor.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autojsoncxx {
+
+namespace binary {
+    // Wire types, in the low three bits of a field tag, tell how to skip an unknown field
+    enum {
+        kVarint = 0,
+        kFixed64 = 1,
+        kLengthDelimited = 2,
+        kFixed32 = 5
+    };
+
+    static const char magic[] = { 'A', 'J', 'X', 'B' };
+    static const std::size_t header_size = sizeof(magic) + 8;
+    static const unsigned max_depth = 1024;
+
+    // Fingerprint of a type from the kind of its encoding and the fingerprint of its elements
+    inline utility::uint64_t type_fingerprint(const char* kind, utility::uint64_t element = 0)
+    {
+        utility::XXHash64 hasher;
+        hasher.update(kind, std::strlen(kind));
+        for (int i = 0; i < 8; ++i)
+            hasher.update(static_cast<unsigned char>(element >> (8 * i)));
+        return hasher.digest();
+    }
+
+    inline utility::uint64_t zigzag_encode(utility::int64_t value)
+    {
+        utility::uint64_t bits = static_cast<utility::uint64_t>(value);
+        return (bits << 1) ^ (value < 0 ? ~utility::uint64_t(0) : 0);
+    }
+
+    inline utility::int64_t zigzag_decode(utility::uint64_t value)
+    {
+        utility::uint64_t bits = (value >> 1) ^ (~(value & 1) + 1);
+        return static_cast<utility::int64_t>(bits);
+    }
+}
+
+// The output of the binary format. Nested messages are prefixed by their length, which is not
+// known until they end, so the output is buffered with a placeholder for every prefix; the
+// buffer is copied out in one pass, with the shortest prefixes, when the root value is complete.
+class BinaryOutput {
+private:
+    struct Nested {
+        std::size_t offset;
+        std::size_t length;
+        std::size_t saved_before;
+    };
+
+    static const std::size_t placeholder_size = 5;
+
+    std::string m_buffer;
+    std::vector<Nested> m_nested;
+    std::vector<std::size_t> m_open;
+    std::size_t m_saved;
+
+    BinaryOutput(const BinaryOutput&);
+    BinaryOutput& operator=(const BinaryOutput&);
+
+    static std::size_t varint_size(utility::uint64_t value)
+    {
+        std::size_t size = 1;
+        while (value >= 0x80) {
+            value >>= 7;
+            ++size;
+        }
+        return size;
+    }
+
+    static std::size_t encode_varint(char* buffer, utility::uint64_t value)
+    {
+        std::size_t size = 0;
+        while (value >= 0x80) {
+            buffer[size++] = static_cast<char>((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        buffer[size++] = static_cast<char>(value);
+        return size;
+    }
+
+public:
+    typedef char Ch;
+
+    explicit BinaryOutput()
+        : m_saved(0)
+    {
+    }
+
+    void Put(char c)
+    {
+        m_buffer.push_back(c);
+    }
+
+    void Flush()
+    {
+    }
+
+    void put_bytes(const char* data, std::size_t length)
+    {
+        m_buffer.append(data, length);
+    }
+
+    void put_varint(utility::uint64_t value)
+    {
+        char buffer[10];
+        m_buffer.append(buffer, encode_varint(buffer, value));
+    }
+
+    void put_fixed64(utility::uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+            m_buffer.push_back(static_cast<char>(value >> (8 * i)));
+    }
+
+    void put_fixed32(unsigned value)
+    {
+        for (int i = 0; i < 4; ++i)
+            m_buffer.push_back(static_cast<char>(value >> (8 * i)));
+    }
+
+    void put_tag(unsigned field, int wire_type)
+    {
+        put_varint(static_cast<utility::uint64_t>(field) << 3 | static_cast<unsigned>(wire_type));
+    }
+
+    void put_header(utility::uint64_t fingerprint)
+    {
+        put_bytes(binary::magic, sizeof(binary::magic));
+        put_fixed64(fingerprint);
+    }
+
+    void begin_nested()
+    {
+        Nested n;
+        n.offset = m_buffer.size();
+        n.length = 0;
+        n.saved_before = m_saved;
+        m_open.push_back(m_nested.size());
+        m_nested.push_back(n);
+        m_buffer.append(placeholder_size, '\0');
+    }
+
+    // The length excludes the bytes that the compaction of inner prefixes will save
+    void end_nested()
+    {
+        Nested& n = m_nested[m_open.back()];
+        m_open.pop_back();
+        n.length = m_buffer.size() - (n.offset + placeholder_size) - (m_saved - n.saved_before);
+        m_saved += placeholder_size - varint_size(n.length);
+    }
+
+    template <class OutputStream>
+    void flush_to(OutputStream& os)
+    {
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < m_nested.size(); ++i) {
+            char prefix[10];
+            put_range(os, m_buffer.data() + pos, m_nested[i].offset - pos);
+            put_range(os, prefix, encode_varint(prefix, m_nested[i].length));
+            pos = m_nested[i].offset + placeholder_size;
+        }
+        put_range(os, m_buffer.data() + pos, m_buffer.size() - pos);
+        m_buffer.clear();
+        m_nested.clear();
+        m_saved = 0;
+    }
+};
+
+// The input of the binary format. Nested messages narrow the readable range to their length,
+// so that a corrupted inner length can never read past its enclosing message.
+class BinaryInput {
+private:
+    const char* m_begin;
+    const char* m_cur;
+    const char* m_end;
+    unsigned m_depth;
+    error::ErrorStack* m_errors;
+
+public:
+    explicit BinaryInput(const char* data, std::size_t length, error::ErrorStack& errors)
+        : m_begin(data)
+        , m_cur(data)
+        , m_end(data + length)
+        , m_depth(0)
+        , m_errors(&errors)
+    {
+    }
+
+    std::size_t offset() const
+    {
+        return static_cast<std::size_t>(m_cur - m_begin);
+    }
+
+    bool at_end() const
+    {
+        return m_cur == m_end;
+    }
+
+    error::ErrorStack& errors()
+    {
+        return *m_errors;
+    }
+
+    bool read_varint(utility::uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64 && m_cur != m_end; shift += 7) {
+            unsigned char c = static_cast<unsigned char>(*m_cur++);
+            value |= static_cast<utility::uint64_t>(c & 0x7f) << shift;
+            if (!(c & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    bool read_fixed(int bytes, utility::uint64_t& value)
+    {
+        if (m_end - m_cur < bytes)
+            return false;
+        value = 0;
+        for (int i = bytes - 1; i >= 0; --i)
+            value = (value << 8) | static_cast<unsigned char>(m_cur[i]);
+        m_cur += bytes;
+        return true;
+    }
+
+    bool read_tag(unsigned& field, int& wire_type)
+    {
+        utility::uint64_t tag;
+        if (!read_varint(tag) || (tag >> 3) > UINT_MAX)
+            return false;
+        field = static_cast<unsigned>(tag >> 3);
+        wire_type = static_cast<int>(tag & 7);
+        return true;
+    }
+
+    // Read a length prefixed run of bytes, which points into the input
+    bool read_bytes(const char*& data, std::size_t& length)
+    {
+        utility::uint64_t value;
+        if (!read_varint(value) || value > static_cast<utility::uint64_t>(m_end - m_cur))
+            return false;
+        data = m_cur;
+        length = static_cast<std::size_t>(value);
+        m_cur += length;
+        return true;
+    }
+
+    bool read_header(utility::uint64_t& fingerprint)
+    {
+        if (static_cast<std::size_t>(m_end - m_cur) < binary::header_size
+            || std::memcmp(m_cur, binary::magic, sizeof(binary::magic)) != 0)
+            return false;
+        m_cur += sizeof(binary::magic);
+        return read_fixed(8, fingerprint);
+    }
+
+    // Enter a nested message; `saved_limit` must be passed back to `end_nested()`
+    bool begin_nested(const char*& saved_limit)
+    {
+        utility::uint64_t length;
+        if (m_depth >= binary::max_depth || !read_varint(length)
+            || length > static_cast<utility::uint64_t>(m_end - m_cur))
+            return false;
+        ++m_depth;
+        saved_limit = m_end;
+        m_end = m_cur + length;
+        return true;
+    }
+
+    void end_nested(const char* saved_limit)
+    {
+        --m_depth;
+        m_end = saved_limit;
+    }
+
+    bool skip(int wire_type)
+    {
+        utility::uint64_t value;
+        const char* data;
+        std::size_t length;
+        switch (wire_type) {
+        case binary::kVarint:
+            return read_varint(value);
+        case binary::kFixed64:
+            return read_fixed(8, value);
+        case binary::kLengthDelimited:
+            return read_bytes(data, length);
+        case binary::kFixed32:
+            return read_fixed(4, value);
+        default:
+            return false;
+        }
+    }
+};
+
+// Encodes and decodes one type in the binary format. Every value is written without a tag, as
+// a varint, eight bytes or a length prefixed payload according to `wire_type`; generated classes
+// tag each member with its field id. Types without a specialization are embedded as CBOR.
+template <class T>
+struct BinaryCodec {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("cbor");
+    }
+
+    static void write(BinaryOutput& out, const T& value)
+    {
+        out.begin_nested();
+        CborWriter<BinaryOutput> writer(out);
+        Serializer<CborWriter<BinaryOutput>, T>()(writer, value);
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, T& value)
+    {
+        const char* data;
+        std::size_t length;
+        if (!in.read_bytes(data, length))
+            return false;
+
+        utility::scoped_ptr<SAXEventHandler<T> > handler(new SAXEventHandler<T>(&value));
+        CborReader reader;
+        if (!reader.Parse(data, length, *handler).IsError())
+            return true;
+        handler->ReapError(in.errors());
+        return false;
+    }
+};
+
+namespace internal {
+    template <class T>
+    struct UnsignedBinaryCodec {
+        static const int wire_type = binary::kVarint;
+
+        static void write(BinaryOutput& out, T value)
+        {
+            out.put_varint(value);
+        }
+
+        static bool read(BinaryInput& in, T& value, utility::uint64_t max_value)
+        {
+            utility::uint64_t v;
+            if (!in.read_varint(v) || v > max_value)
+                return false;
+            value = static_cast<T>(v);
+            return true;
+        }
+    };
+
+    template <class T>
+    struct SignedBinaryCodec {
+        static const int wire_type = binary::kVarint;
+
+        static void write(BinaryOutput& out, T value)
+        {
+            out.put_varint(binary::zigzag_encode(value));
+        }
+
+        static bool read(BinaryInput& in, T& value, utility::int64_t min_value, utility::int64_t max_value)
+        {
+            utility::uint64_t v;
+            if (!in.read_varint(v))
+                return false;
+            utility::int64_t decoded = binary::zigzag_decode(v);
+            if (decoded < min_value || decoded > max_value)
+                return false;
+            value = static_cast<T>(decoded);
+            return true;
+        }
+    };
+}
+
+template <>
+struct BinaryCodec<bool> : public internal::UnsignedBinaryCodec<bool> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("bool");
+    }
+
+    static bool read(BinaryInput& in, bool& value)
+    {
+        return internal::UnsignedBinaryCodec<bool>::read(in, value, 1);
+    }
+};
+
+template <>
+struct BinaryCodec<char> : public internal::UnsignedBinaryCodec<unsigned char> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("char");
+    }
+
+    static void write(BinaryOutput& out, char value)
+    {
+        out.put_varint(static_cast<unsigned char>(value));
+    }
+
+    static bool read(BinaryInput& in, char& value)
+    {
+        unsigned char c;
+        if (!internal::UnsignedBinaryCodec<unsigned char>::read(in, c, UCHAR_MAX))
+            return false;
+        value = static_cast<char>(c);
+        return true;
+    }
+};
+
+template <>
+struct BinaryCodec<int> : public internal::SignedBinaryCodec<int> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("int");
+    }
+
+    static bool read(BinaryInput& in, int& value)
+    {
+        return internal::SignedBinaryCodec<int>::read(in, value, INT_MIN, INT_MAX);
+    }
+};
+
+template <>
+struct BinaryCodec<unsigned> : public internal::UnsignedBinaryCodec<unsigned> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("unsigned");
+    }
+
+    static bool read(BinaryInput& in, unsigned& value)
+    {
+        return internal::UnsignedBinaryCodec<unsigned>::read(in, value, UINT_MAX);
+    }
+};
+
+template <>
+struct BinaryCodec<utility::int8_t> : public internal::SignedBinaryCodec<utility::int8_t> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("int8");
+    }
+
+    static bool read(BinaryInput& in, utility::int8_t& value)
+    {
+        return internal::SignedBinaryCodec<utility::int8_t>::read(in, value, SCHAR_MIN, SCHAR_MAX);
+    }
+};
+
+template <>
+struct BinaryCodec<utility::uint8_t> : public internal::UnsignedBinaryCodec<utility::uint8_t> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("uint8");
+    }
+
+    static bool read(BinaryInput& in, utility::uint8_t& value)
+    {
+        return internal::UnsignedBinaryCodec<utility::uint8_t>::read(in, value, UCHAR_MAX);
+    }
+};
+
+template <>
+struct BinaryCodec<utility::int16_t> : public internal::SignedBinaryCodec<utility::int16_t> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("int16");
+    }
+
+    static bool read(BinaryInput& in, utility::int16_t& value)
+    {
+        return internal::SignedBinaryCodec<utility::int16_t>::read(in, value, SHRT_MIN, SHRT_MAX);
+    }
+};
+
+template <>
+struct BinaryCodec<utility::uint16_t> : public internal::UnsignedBinaryCodec<utility::uint16_t> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("uint16");
+    }
+
+    static bool read(BinaryInput& in, utility::uint16_t& value)
+    {
+        return internal::UnsignedBinaryCodec<utility::uint16_t>::read(in, value, USHRT_MAX);
+    }
+};
+
+template <>
+struct BinaryCodec<utility::int64_t> : public internal::SignedBinaryCodec<utility::int64_t> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("int64");
+    }
+
+    static bool read(BinaryInput& in, utility::int64_t& value)
+    {
+        return internal::SignedBinaryCodec<utility::int64_t>::read(
+            in, value, -9223372036854775807LL - 1, 9223372036854775807LL);
+    }
+};
+
+template <>
+struct BinaryCodec<utility::uint64_t> : public internal::UnsignedBinaryCodec<utility::uint64_t> {
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("uint64");
+    }
+
+    static bool read(BinaryInput& in, utility::uint64_t& value)
+    {
+        return internal::UnsignedBinaryCodec<utility::uint64_t>::read(in, value, ~utility::uint64_t(0));
+    }
+};
+
+template <>
+struct BinaryCodec<double> {
+    static const int wire_type = binary::kFixed64;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("double");
+    }
+
+    static void write(BinaryOutput& out, double value)
+    {
+        utility::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        out.put_fixed64(bits);
+    }
+
+    static bool read(BinaryInput& in, double& value)
+    {
+        utility::uint64_t bits;
+        if (!in.read_fixed(8, bits))
+            return false;
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+};
+
+template <>
+struct BinaryCodec<float> {
+    static const int wire_type = binary::kFixed32;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("float");
+    }
+
+    static void write(BinaryOutput& out, float value)
+    {
+        unsigned bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        out.put_fixed32(bits);
+    }
+
+    static bool read(BinaryInput& in, float& value)
+    {
+        utility::uint64_t bits;
+        if (!in.read_fixed(4, bits))
+            return false;
+        unsigned low = static_cast<unsigned>(bits);
+        std::memcpy(&value, &low, sizeof(value));
+        return true;
+    }
+};
+
+template <>
+struct BinaryCodec<std::string> {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("string");
+    }
+
+    static void write(BinaryOutput& out, const std::string& value)
+    {
+        out.put_varint(value.size());
+        out.put_bytes(value.data(), value.size());
+    }
+
+    static bool read(BinaryInput& in, std::string& value)
+    {
+        const char* data;
+        std::size_t length;
+        if (!in.read_bytes(data, length))
+            return false;
+        value.assign(data, length);
+        return true;
+    }
+};
+
+namespace internal {
+    // The formatted types keep their bytes rather than their text
+    template <class T>
+    struct FormattedBinaryCodec {
+        static const int wire_type = binary::kLengthDelimited;
+
+        static utility::uint64_t fingerprint()
+        {
+            return binary::type_fingerprint(SAXEventHandler<T>::type_name());
+        }
+
+        static void write(BinaryOutput& out, const T& value)
+        {
+            out.put_varint(sizeof(value.bytes));
+            out.put_bytes(reinterpret_cast<const char*>(value.bytes), sizeof(value.bytes));
+        }
+
+        static bool read(BinaryInput& in, T& value)
+        {
+            const char* data;
+            std::size_t length;
+            if (!in.read_bytes(data, length) || length != sizeof(value.bytes))
+                return false;
+            std::memcpy(value.bytes, data, length);
+            return true;
+        }
+    };
+}
+
+template <>
+struct BinaryCodec<uuid> : public internal::FormattedBinaryCodec<uuid> {
+};
+
+template <>
+struct BinaryCodec<ipv4_address> : public internal::FormattedBinaryCodec<ipv4_address> {
+};
+
+template <>
+struct BinaryCodec<ipv6_address> : public internal::FormattedBinaryCodec<ipv6_address> {
+};
+
+template <>
+struct BinaryCodec<bytes> {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("bytes");
+    }
+
+    static void write(BinaryOutput& out, const bytes& value)
+    {
+        out.put_varint(value.size());
+        if (!value.empty())
+            out.put_bytes(reinterpret_cast<const char*>(&value[0]), value.size());
+    }
+
+    static bool read(BinaryInput& in, bytes& value)
+    {
+        const char* data;
+        std::size_t length;
+        if (!in.read_bytes(data, length))
+            return false;
+        value.assign(data, data + length);
+        return true;
+    }
+};
+
+// Sequences are the concatenation of their elements, so numbers end up packed
+template <class Container, class ValueType>
+struct SequenceBinaryCodec {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("sequence", BinaryCodec<ValueType>::fingerprint());
+    }
+
+    static void write(BinaryOutput& out, const Container& value)
+    {
+        out.begin_nested();
+        for (typename Container::const_iterator it = value.begin(), end = value.end(); it != end; ++it)
+            BinaryCodec<ValueType>::write(out, *it);
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, Container& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+        value.clear();
+        while (!in.at_end()) {
+            value.push_back(ValueType());
+            if (!BinaryCodec<ValueType>::read(in, value.back()))
+                return false;
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <class T, class Allocator>
+struct BinaryCodec<std::vector<T, Allocator> >
+    : public SequenceBinaryCodec<std::vector<T, Allocator>, T> {
+};
+
+template <class Allocator>
+struct BinaryCodec<std::vector<bool, Allocator> >
+    : public SequenceBinaryCodec<std::vector<bool, Allocator>, bool> {
+    static bool read(BinaryInput& in, std::vector<bool, Allocator>& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+        value.clear();
+        while (!in.at_end()) {
+            bool element;
+            if (!BinaryCodec<bool>::read(in, element))
+                return false;
+            value.push_back(element);
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <class T, class Allocator>
+struct BinaryCodec<std::deque<T, Allocator> >
+    : public SequenceBinaryCodec<std::deque<T, Allocator>, T> {
+};
+
+// Maps are the concatenation of their keys, as length prefixed strings, and values
+template <class MapType, class ElementType>
+struct MapBinaryCodec {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("map", BinaryCodec<ElementType>::fingerprint());
+    }
+
+    static void write(BinaryOutput& out, const MapType& value)
+    {
+        out.begin_nested();
+        for (typename MapType::const_iterator it = value.begin(), end = value.end(); it != end; ++it) {
+            BinaryCodec<std::string>::write(out, it->first);
+            BinaryCodec<ElementType>::write(out, it->second);
+        }
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, MapType& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+        value.clear();
+        while (!in.at_end()) {
+            std::string key;
+            if (!BinaryCodec<std::string>::read(in, key))
+                return false;
+            typename MapType::iterator it = value.insert(value.end(), typename MapType::value_type(key, ElementType()));
+            if (!BinaryCodec<ElementType>::read(in, it->second))
+                return false;
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <class ElementType, class Compare, class Allocator>
+struct BinaryCodec<std::map<std::string, ElementType, Compare, Allocator> >
+    : public MapBinaryCodec<std::map<std::string, ElementType, Compare, Allocator>, ElementType> {
+};
+
+template <class ElementType, class Compare, class Allocator>
+struct BinaryCodec<std::multimap<std::string, ElementType, Compare, Allocator> >
+    : public MapBinaryCodec<std::multimap<std::string, ElementType, Compare, Allocator>, ElementType> {
+};
+
+#if AUTOJSONCXX_HAS_MODERN_TYPES
+
+template <class T, std::size_t N>
+struct BinaryCodec<std::array<T, N> > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("sequence", BinaryCodec<T>::fingerprint());
+    }
+
+    static void write(BinaryOutput& out, const std::array<T, N>& value)
+    {
+        out.begin_nested();
+        for (std::size_t i = 0; i < N; ++i)
+            BinaryCodec<T>::write(out, value[i]);
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, std::array<T, N>& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (in.at_end() || !BinaryCodec<T>::read(in, value[i]))
+                return false;
+        }
+        if (!in.at_end())
+            return false;
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <class ElementType, class Hash, class Equal, class Allocator>
+struct BinaryCodec<std::unordered_map<std::string, ElementType, Hash, Equal, Allocator> >
+    : public MapBinaryCodec<std::unordered_map<std::string, ElementType, Hash, Equal, Allocator>, ElementType> {
+};
+
+template <class ElementType, class Hash, class Equal, class Allocator>
+struct BinaryCodec<std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator> >
+    : public MapBinaryCodec<std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>, ElementType> {
+};
+
+// Pointers are written as an empty payload when null, and as the value they point to otherwise
+template <class Pointer, class T>
+struct PointerBinaryCodec {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return binary::type_fingerprint("nullable", BinaryCodec<T>::fingerprint());
+    }
+
+    static void write(BinaryOutput& out, const Pointer& value)
+    {
+        out.begin_nested();
+        if (value)
+            BinaryCodec<T>::write(out, *value);
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, Pointer& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+        if (in.at_end()) {
+            value.reset();
+        } else {
+            value.reset(new T());
+            if (!BinaryCodec<T>::read(in, *value) || !in.at_end())
+                return false;
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <class T>
+struct BinaryCodec<std::shared_ptr<T> > : public PointerBinaryCodec<std::shared_ptr<T>, T> {
+};
+
+template <class T, class Deleter>
+struct BinaryCodec<std::unique_ptr<T, Deleter> > : public PointerBinaryCodec<std::unique_ptr<T, Deleter>, T> {
+};
+
+#endif
+
+template <class OutputStream, class ValueType>
+inline void to_binary(OutputStream& os, const ValueType& v)
+{
+    BinaryOutput out;
+    out.put_header(BinaryCodec<ValueType>::fingerprint());
+    BinaryCodec<ValueType>::write(out, v);
+    out.flush_to(os);
+    os.Flush();
+}
+
+template <class ValueType>
+inline void to_binary_string(std::string& str, const ValueType& v)
+{
+    str.clear();
+    StringOutputStream os(str);
+    to_binary(os, v);
+}
+
+template <class ValueType>
+inline std::string to_binary_string(const ValueType& v)
+{
+    std::string result;
+    to_binary_string(result, v);
+    return result;
+}
+
+template <class ValueType>
+inline bool from_binary(const char* data, std::size_t length, ValueType& value, ParsingResult& result)
+{
+    result.set_result(rapidjson::ParseResult());
+    if (length == 0) {
+        result.set_result(rapidjson::kParseErrorDocumentEmpty, 0);
+        return false;
+    }
+
+    BinaryInput in(data, length, result.error_stack());
+    utility::uint64_t fingerprint;
+    if (!in.read_header(fingerprint)) {
+        result.set_result(rapidjson::kParseErrorValueInvalid, 0);
+        return false;
+    }
+    if (fingerprint != BinaryCodec<ValueType>::fingerprint()) {
+        result.error_stack().push_copy(error::SchemaMismatchError(BinaryCodec<ValueType>::fingerprint(), fingerprint));
+        result.set_result(rapidjson::kParseErrorTermination, sizeof(binary::magic));
+        return false;
+    }
+
+    if (!BinaryCodec<ValueType>::read(in, value)) {
+        result.set_result(result.error_stack().empty() ? rapidjson::kParseErrorValueInvalid
+                                                       : rapidjson::kParseErrorTermination,
+                          in.offset());
+        return false;
+    }
+    if (!in.at_end()) {
+        result.set_result(rapidjson::kParseErrorDocumentRootNotSingular, in.offset());
+        return false;
+    }
+    return true;
+}
+
+template <class ValueType>
+inline bool from_binary_string(const std::string& data, ValueType& value, ParsingResult& result)
+{
+    return from_binary(data.data(), data.size(), value, result);
+}
+}
+
+#endif
@@ -433,7 +433,7 @@ public:
 
 template <class Writer, class ElementType, class Hash, class Equal, class Allocator>
 struct Serializer<Writer, boost::unordered_map<std::string, ElementType, Hash, Equal, Allocator> >
-    : public MapSerializer<Writer, boost::unordered_map<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename boost::unordered_map<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
+    : public UnorderedMapSerializer<Writer, boost::unordered_map<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename boost::unordered_map<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
 };
 
 template <class ElementType, class Hash, class Equal, class Allocator>
@@ -468,7 +468,7 @@ public:
 
 template <class Writer, class ElementType, class Hash, class Equal, class Allocator>
 struct Serializer<Writer, boost::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator> >
-    : public MapSerializer<Writer, boost::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename boost::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
+    : public UnorderedMapSerializer<Writer, boost::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename boost::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
 };
 }
 
@@ -0,0 +1,686 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef AUTOJSONCXX_CBOR_HPP_29A4C106C1B1
+#define AUTOJSONCXX_CBOR_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/escape.hpp>
+#include <autojsoncxx/to_json.hpp>
+
+#include <rapidjson/error/error.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace autojsoncxx {
+
+namespace cbor {
+    // Major types, in the top three bits of the initial byte
+    enum {
+        kUnsigned = 0,
+        kNegative = 1,
+        kBytes = 2,
+        kText = 3,
+        kArray = 4,
+        kMap = 5,
+        kTag = 6,
+        kSimple = 7
+    };
+
+    // Additional information, in the low five bits of the initial byte
+    enum {
+        kOneByte = 24,
+        kTwoBytes = 25,
+        kFourBytes = 26,
+        kEightBytes = 27,
+        kIndefinite = 31
+    };
+
+    enum {
+        kFalse = 0xf4,
+        kTrue = 0xf5,
+        kNull = 0xf6,
+        kUndefined = 0xf7,
+        kFloat16 = 0xf9,
+        kFloat32 = 0xfa,
+        kFloat64 = 0xfb,
+        kBreak = 0xff
+    };
+}
+
+namespace utility {
+    // Returns true and the IEEE half precision bits if `f` converts to half precision exactly
+    inline bool float_to_half(float f, unsigned& half)
+    {
+        unsigned bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        unsigned sign = (bits >> 16) & 0x8000u;
+        int exponent = static_cast<int>((bits >> 23) & 0xff);
+        unsigned mantissa = bits & 0x7fffffu;
+
+        if (exponent == 0xff) {
+            if (mantissa != 0 && (mantissa & 0x1fff) != 0)
+                return false;
+            half = sign | 0x7c00u | (mantissa >> 13);
+            return true;
+        }
+        if (exponent == 0 && mantissa == 0) {
+            half = sign;
+            return true;
+        }
+        if (exponent == 0)
+            return false;
+
+        int e = exponent - 127;
+        if (e > 15 || e < -24)
+            return false;
+        if (e >= -14) {
+            if (mantissa & 0x1fff)
+                return false;
+            half = sign | static_cast<unsigned>(e + 15) << 10 | (mantissa >> 13);
+            return true;
+        }
+        // Subnormal half: the implicit bit joins the mantissa, shifted right past the exponent
+        unsigned full = mantissa | 0x800000u;
+        int shift = 13 + (-14 - e);
+        if (full & ((1u << shift) - 1))
+            return false;
+        half = sign | (full >> shift);
+        return true;
+    }
+
+    inline double half_to_double(unsigned half)
+    {
+        int exponent = (half >> 10) & 0x1f;
+        double mantissa = half & 0x3ff;
+        double value;
+        if (exponent == 0)
+            value = std::ldexp(mantissa, -24);
+        else if (exponent != 31)
+            value = std::ldexp(mantissa + 1024, exponent - 25);
+        else if (mantissa == 0)
+            value = std::numeric_limits<double>::infinity();
+        else
+            value = std::numeric_limits<double>::quiet_NaN();
+        return (half & 0x8000u) ? -value : value;
+    }
+}
+
+// A writer producing CBOR (RFC 8949) instead of JSON text, usable with every `Serializer`.
+// Serializers that know the size of a container up front announce it through `ContainerStarter`,
+// which gets a definite length header; containers started without a size are written with
+// indefinite length. Either way the output is streamed with no intermediate buffer.
+// Floating point numbers take the shortest of half, single and double precision that is exact.
+template <class OutputStream>
+class CborWriter {
+private:
+    OutputStream* m_os;
+    std::vector<bool> m_indefinite;
+
+    CborWriter(const CborWriter&);
+    CborWriter& operator=(const CborWriter&);
+
+    void put(unsigned char c)
+    {
+        m_os->Put(static_cast<char>(c));
+    }
+
+    void put_big_endian(utility::uint64_t value, int bytes)
+    {
+        char buffer[8];
+        for (int i = 0; i < bytes; ++i)
+            buffer[i] = static_cast<char>(value >> (8 * (bytes - 1 - i)));
+        put_range(*m_os, buffer, bytes);
+    }
+
+    void put_head(int major, utility::uint64_t argument)
+    {
+        unsigned char initial = static_cast<unsigned char>(major << 5);
+        if (argument < cbor::kOneByte) {
+            put(static_cast<unsigned char>(initial | argument));
+        } else if (argument <= 0xFF) {
+            put(initial | cbor::kOneByte);
+            put_big_endian(argument, 1);
+        } else if (argument <= 0xFFFF) {
+            put(initial | cbor::kTwoBytes);
+            put_big_endian(argument, 2);
+        } else if (argument <= 0xFFFFFFFFu) {
+            put(initial | cbor::kFourBytes);
+            put_big_endian(argument, 4);
+        } else {
+            put(initial | cbor::kEightBytes);
+            put_big_endian(argument, 8);
+        }
+    }
+
+    void put_signed(utility::int64_t value)
+    {
+        if (value >= 0)
+            put_head(cbor::kUnsigned, static_cast<utility::uint64_t>(value));
+        else
+            put_head(cbor::kNegative, static_cast<utility::uint64_t>(-(value + 1)));
+    }
+
+    void start_container(int major)
+    {
+        put(static_cast<unsigned char>(major << 5 | cbor::kIndefinite));
+        m_indefinite.push_back(true);
+    }
+
+    void start_container(int major, SizeType size)
+    {
+        put_head(major, size);
+        m_indefinite.push_back(false);
+    }
+
+    void end_container()
+    {
+        if (m_indefinite.back())
+            put(cbor::kBreak);
+        m_indefinite.pop_back();
+    }
+
+public:
+    typedef char Ch;
+
+    explicit CborWriter(OutputStream& os)
+        : m_os(&os)
+    {
+    }
+
+    bool Null()
+    {
+        put(cbor::kNull);
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        put(b ? cbor::kTrue : cbor::kFalse);
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        put_signed(i);
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        put_head(cbor::kUnsigned, i);
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        put_signed(i);
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        put_head(cbor::kUnsigned, i);
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        double magnitude = std::fabs(d);
+        bool in_float_range = !(magnitude > std::numeric_limits<float>::max())
+            || magnitude == std::numeric_limits<double>::infinity();
+        float f = in_float_range ? static_cast<float>(d) : 0.0f;
+        if (in_float_range && (f == d || d != d)) {
+            unsigned half;
+            if (utility::float_to_half(f, half)) {
+                put(cbor::kFloat16);
+                put_big_endian(half, 2);
+            } else {
+                unsigned bits;
+                std::memcpy(&bits, &f, sizeof(bits));
+                put(cbor::kFloat32);
+                put_big_endian(bits, 4);
+            }
+        } else {
+            utility::uint64_t bits;
+            std::memcpy(&bits, &d, sizeof(bits));
+            put(cbor::kFloat64);
+            put_big_endian(bits, 8);
+        }
+        return true;
+    }
+
+    bool String(const Ch* str, SizeType length, bool = false)
+    {
+        put_head(cbor::kText, length);
+        put_range(*m_os, str, length);
+        return true;
+    }
+
+    // Writes a byte string, which `CborReader` delivers back as a `String()` event
+    bool Bytes(const void* data, SizeType length)
+    {
+        put_head(cbor::kBytes, length);
+        put_range(*m_os, static_cast<const char*>(data), length);
+        return true;
+    }
+
+    bool Key(const Ch* str, SizeType length, bool = false)
+    {
+        return String(str, length);
+    }
+
+    bool StartObject()
+    {
+        start_container(cbor::kMap);
+        return true;
+    }
+
+    bool StartObject(SizeType size)
+    {
+        start_container(cbor::kMap, size);
+        return true;
+    }
+
+    bool EndObject(SizeType = 0)
+    {
+        end_container();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        start_container(cbor::kArray);
+        return true;
+    }
+
+    bool StartArray(SizeType size)
+    {
+        start_container(cbor::kArray, size);
+        return true;
+    }
+
+    bool EndArray(SizeType = 0)
+    {
+        end_container();
+        return true;
+    }
+};
+
+namespace utility {
+    namespace traits {
+        template <class OutputStream>
+        struct accepts_container_sizes<CborWriter<OutputStream> > : public true_type {
+        };
+    }
+}
+
+// Reads CBOR and drives a handler with the same events `rapidjson::Reader` produces for the
+// equivalent JSON, so every `SAXEventHandler` works unchanged. Maps must have text keys.
+// Byte strings are delivered as strings, tags are skipped and `undefined` reads as null.
+// Definite length strings point straight into the input, which must outlive the parsing.
+class CborReader {
+private:
+    struct Frame {
+        utility::uint64_t remaining;
+        SizeType count;
+        bool is_map;
+        bool indefinite;
+        bool expect_key;
+    };
+
+    const unsigned char* m_begin;
+    const unsigned char* m_cur;
+    const unsigned char* m_end;
+    std::vector<Frame> m_stack;
+    std::string m_scratch;
+
+    rapidjson::ParseResult error(rapidjson::ParseErrorCode code) const
+    {
+        return rapidjson::ParseResult(code, static_cast<std::size_t>(m_cur - m_begin));
+    }
+
+    bool read_big_endian(int bytes, utility::uint64_t& value)
+    {
+        if (m_end - m_cur < bytes)
+            return false;
+        value = 0;
+        for (int i = 0; i < bytes; ++i)
+            value = (value << 8) | *m_cur++;
+        return true;
+    }
+
+    // Decode the argument following an initial byte; indefinite lengths are handled by the caller
+    bool read_argument(unsigned info, utility::uint64_t& value)
+    {
+        if (info < cbor::kOneByte) {
+            value = info;
+            return true;
+        }
+        if (info > cbor::kEightBytes)
+            return false;
+        return read_big_endian(1 << (info - cbor::kOneByte), value);
+    }
+
+    bool read_bytes(utility::uint64_t length, const char*& data)
+    {
+        if (static_cast<utility::uint64_t>(m_end - m_cur) < length)
+            return false;
+        data = reinterpret_cast<const char*>(m_cur);
+        m_cur += length;
+        return true;
+    }
+
+    // Read a byte or text string whose initial byte has been consumed. Chunked strings are
+    // joined in the scratch buffer, and the others point into the input, so either way
+    // the handler is told to copy them, as neither outlives the parsing.
+    bool read_string(int major, unsigned info, const char*& data, SizeType& length)
+    {
+        utility::uint64_t value;
+        if (info != cbor::kIndefinite) {
+            if (!read_argument(info, value) || !read_bytes(value, data))
+                return false;
+            length = static_cast<SizeType>(value);
+            return length == value;
+        }
+        m_scratch.clear();
+        while (true) {
+            if (m_cur == m_end)
+                return false;
+            unsigned char initial = *m_cur++;
+            if (initial == cbor::kBreak)
+                break;
+            const char* chunk;
+            if ((initial >> 5) != major || (initial & 0x1f) == cbor::kIndefinite
+                || !read_argument(initial & 0x1f, value) || !read_bytes(value, chunk))
+                return false;
+            m_scratch.append(chunk, static_cast<std::size_t>(value));
+        }
+        data = m_scratch.data();
+        length = static_cast<SizeType>(m_scratch.size());
+        return length == m_scratch.size();
+    }
+
+    template <class Handler>
+    static bool forward_unsigned(Handler& handler, utility::uint64_t value)
+    {
+        if (value <= 0xFFFFFFFFu)
+            return handler.Uint(static_cast<unsigned>(value));
+        return handler.Uint64(value);
+    }
+
+    // CBOR negative integers encode -1 - value, which may be beyond the range of int64_t
+    template <class Handler>
+    static bool forward_negative(Handler& handler, utility::uint64_t value)
+    {
+        if (value <= 2147483647u)
+            return handler.Int(-1 - static_cast<int>(value));
+        if (value <= 9223372036854775807ull)
+            return handler.Int64(-1 - static_cast<utility::int64_t>(value));
+        return handler.Double(-1.0 - static_cast<double>(value));
+    }
+
+    bool push_frame(unsigned info, bool is_map)
+    {
+        Frame f;
+        f.remaining = 0;
+        f.count = 0;
+        f.is_map = is_map;
+        f.indefinite = (info == cbor::kIndefinite);
+        f.expect_key = is_map;
+        if (!f.indefinite) {
+            if (!read_argument(info, f.remaining))
+                return false;
+            // Every element takes at least one byte, which bounds bogus counts
+            utility::uint64_t available = static_cast<utility::uint64_t>(m_end - m_cur);
+            if (f.remaining > (is_map ? available / 2 : available))
+                return false;
+        }
+        m_stack.push_back(f);
+        return true;
+    }
+
+    void value_completed()
+    {
+        if (!m_stack.empty()) {
+            Frame& f = m_stack.back();
+            if (!f.indefinite)
+                --f.remaining;
+            ++f.count;
+            f.expect_key = f.is_map;
+        }
+    }
+
+    // Whether the innermost container is complete; consumes the break of indefinite ones
+    bool container_finished(bool& truncated)
+    {
+        const Frame& f = m_stack.back();
+        truncated = false;
+        if (!f.indefinite)
+            return f.remaining == 0;
+        if (m_cur == m_end) {
+            truncated = true;
+            return false;
+        }
+        if (*m_cur != cbor::kBreak)
+            return false;
+        ++m_cur;
+        return true;
+    }
+
+public:
+    explicit CborReader()
+        : m_begin(0)
+        , m_cur(0)
+        , m_end(0)
+    {
+    }
+
+    template <class Handler>
+    rapidjson::ParseResult Parse(const char* data, std::size_t length, Handler& handler)
+    {
+        m_begin = m_cur = reinterpret_cast<const unsigned char*>(data);
+        m_end = m_begin + length;
+        m_stack.clear();
+
+        if (m_cur == m_end)
+            return error(rapidjson::kParseErrorDocumentEmpty);
+
+        do {
+            if (!m_stack.empty()) {
+                bool truncated;
+                if (container_finished(truncated)) {
+                    Frame f = m_stack.back();
+                    m_stack.pop_back();
+                    if (f.is_map && !f.expect_key)
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    if (!(f.is_map ? handler.EndObject(f.count) : handler.EndArray(f.count)))
+                        return error(rapidjson::kParseErrorTermination);
+                    value_completed();
+                    continue;
+                }
+                if (truncated)
+                    return error(rapidjson::kParseErrorValueInvalid);
+            }
+
+            if (m_cur == m_end)
+                return error(rapidjson::kParseErrorValueInvalid);
+
+            const unsigned char* start = m_cur;
+            unsigned char initial = *m_cur++;
+            utility::uint64_t value = 0;
+            bool ok = true;
+
+            while ((initial >> 5) == cbor::kTag) {
+                if (!read_argument(initial & 0x1f, value) || m_cur == m_end)
+                    return error(rapidjson::kParseErrorValueInvalid);
+                start = m_cur;
+                initial = *m_cur++;
+            }
+            int major = initial >> 5;
+            unsigned info = initial & 0x1f;
+
+            if (!m_stack.empty() && m_stack.back().expect_key) {
+                const char* key;
+                SizeType key_length;
+                if (major != cbor::kText) {
+                    m_cur = start;
+                    return error(rapidjson::kParseErrorObjectMissName);
+                }
+                if (!read_string(major, info, key, key_length))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                if (!handler.Key(key, key_length, true))
+                    return error(rapidjson::kParseErrorTermination);
+                m_stack.back().expect_key = false;
+                continue;
+            }
+
+            switch (major) {
+            case cbor::kUnsigned:
+                if (!read_argument(info, value))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                ok = forward_unsigned(handler, value);
+                break;
+            case cbor::kNegative:
+                if (!read_argument(info, value))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                ok = forward_negative(handler, value);
+                break;
+            case cbor::kBytes:
+            case cbor::kText: {
+                const char* str;
+                SizeType str_length;
+                if (!read_string(major, info, str, str_length))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                ok = handler.String(str, str_length, true);
+                break;
+            }
+            case cbor::kArray:
+            case cbor::kMap:
+                if (!push_frame(info, major == cbor::kMap))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                if (!(major == cbor::kMap ? handler.StartObject() : handler.StartArray()))
+                    return error(rapidjson::kParseErrorTermination);
+                continue;
+            default:
+                switch (initial) {
+                case cbor::kNull:
+                case cbor::kUndefined:
+                    ok = handler.Null();
+                    break;
+                case cbor::kFalse:
+                    ok = handler.Bool(false);
+                    break;
+                case cbor::kTrue:
+                    ok = handler.Bool(true);
+                    break;
+                case cbor::kFloat16:
+                    if (!read_big_endian(2, value))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    ok = handler.Double(utility::half_to_double(static_cast<unsigned>(value)));
+                    break;
+                case cbor::kFloat32: {
+                    if (!read_big_endian(4, value))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    unsigned bits = static_cast<unsigned>(value);
+                    float f;
+                    std::memcpy(&f, &bits, sizeof(f));
+                    ok = handler.Double(f);
+                    break;
+                }
+                case cbor::kFloat64: {
+                    if (!read_big_endian(8, value))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    double d;
+                    std::memcpy(&d, &value, sizeof(d));
+                    ok = handler.Double(d);
+                    break;
+                }
+                default:
+                    m_cur = start;
+                    return error(rapidjson::kParseErrorValueInvalid);
+                }
+            }
+
+            if (!ok)
+                return error(rapidjson::kParseErrorTermination);
+            value_completed();
+        } while (!m_stack.empty());
+
+        if (m_cur != m_end)
+            return error(rapidjson::kParseErrorDocumentRootNotSingular);
+        return rapidjson::ParseResult();
+    }
+};
+
+template <class OutputStream, class ValueType>
+inline void to_cbor(OutputStream& os, const ValueType& v)
+{
+    CborWriter<OutputStream> writer(os);
+    Serializer<CborWriter<OutputStream>, ValueType>()(writer, v);
+    os.Flush();
+}
+
+template <class ValueType>
+inline void to_cbor_string(std::string& str, const ValueType& v)
+{
+    str.clear();
+    StringOutputStream os(str);
+    to_cbor(os, v);
+}
+
+template <class ValueType>
+inline std::string to_cbor_string(const ValueType& v)
+{
+    std::string result;
+    to_cbor_string(result, v);
+    return result;
+}
+
+template <class ValueType>
+inline bool from_cbor(const char* data, std::size_t length, ValueType& value, ParsingResult& result)
+{
+    typedef SAXEventHandler<ValueType> handler_type;
+
+    utility::scoped_ptr<handler_type> handler(new handler_type(&value));
+
+    CborReader reader;
+    result.set_result(reader.Parse(data, length, *handler));
+    handler->ReapError(result.error_stack());
+    return !result.has_error();
+}
+
+template <class ValueType>
+inline bool from_cbor_string(const std::string& data, ValueType& value, ParsingResult& result)
+{
+    return from_cbor(data.data(), data.size(), value, result);
+}
+}
+
+#endif
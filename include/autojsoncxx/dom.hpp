@@ -40,7 +40,7 @@ public:
 
 private:
     utility::stack<value_type, 32> working_stack;
-    utility::scoped_ptr<error::ErrorBase> the_error;
+    error::ErrorHolder the_error;
     document_type* doc;
 
 private:
@@ -54,7 +54,7 @@ private:
 
     bool set_dom_error(const char* message)
     {
-        the_error.reset(new error::CorruptedDOMError(message));
+        the_error.set<error::CorruptedDOMError>(message);
         return false;
     }
 
@@ -207,7 +207,7 @@ public:
         if (this->the_error.empty())
             return false;
 
-        errs.push(this->the_error.release());
+        the_error.move_to(errs);
         return true;
     }
 
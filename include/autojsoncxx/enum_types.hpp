@@ -0,0 +1,136 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef AUTOJSONCXX_ENUM_TYPES_HPP_29A4C106C1B1
+#define AUTOJSONCXX_ENUM_TYPES_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/validation.hpp>
+
+#include <string>
+#include <cstring>
+#include <limits>
+
+namespace autojsoncxx {
+
+// The JSON spelling of an enumerator, and the same spelling quoted and escaped as the writer would
+struct EnumSpelling {
+    const char* name;
+    SizeType length;
+    const char* token;
+    SizeType token_length;
+};
+
+// Generated for every enum declared in the definition file, whose enumerators are numbered from zero:
+//
+//     static const char* type_name();
+//     static SizeType count();
+//     static const EnumSpelling* spellings();
+//     static int find(const char* str, SizeType length);    // the enumerator, or -1
+template <class Enum>
+struct EnumTraits;
+
+namespace internal {
+    // Looks up a spelling in a perfect hash table built by the generator,
+    // whose slots hold the index of a spelling, or -1 when empty
+    inline int find_spelling(const EnumSpelling* spellings, const char* str, SizeType length,
+                             const int* slots, utility::SizeType seed, utility::SizeType mask)
+    {
+        int index = slots[validation::string_hash(str, length, seed) & mask];
+        if (index < 0)
+            return -1;
+        const EnumSpelling& s = spellings[index];
+        return s.length == length && std::memcmp(s.name, str, length) == 0 ? index : -1;
+    }
+}
+
+template <class Enum>
+class EnumSAXEventHandler : public BaseSAXEventHandler<EnumSAXEventHandler<Enum> > {
+private:
+    Enum* m_value;
+
+    error::RejectedText m_unknown_value;
+
+public:
+    explicit EnumSAXEventHandler(Enum* v)
+        : m_value(v)
+    {
+    }
+
+    bool String(const char* str, SizeType length, bool)
+    {
+        int index = EnumTraits<Enum>::find(str, length);
+        if (index < 0) {
+            this->the_error.template set<error::UnknownEnumValueError>(type_name(), m_unknown_value.keep(str, length));
+            return false;
+        }
+        *m_value = static_cast<Enum>(index);
+        return true;
+    }
+
+    // A value without a spelling is written as its integer, and read back only in that form
+    bool Int(int i)
+    {
+        if (i >= 0 && static_cast<std::size_t>(i) < EnumTraits<Enum>::count())
+            return this->set_type_mismatch("int");
+        *m_value = static_cast<Enum>(i);
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (i < EnumTraits<Enum>::count())
+            return this->set_type_mismatch("unsigned");
+        if (i > static_cast<unsigned>(std::numeric_limits<int>::max()))
+            return this->set_out_of_range("unsigned");
+        *m_value = static_cast<Enum>(static_cast<int>(i));
+        return true;
+    }
+
+    static const char* type_name()
+    {
+        return EnumTraits<Enum>::type_name();
+    }
+};
+
+// Writes the precomputed spelling, verbatim to writers that accept string tokens
+template <class Writer, class Enum>
+struct EnumSerializer {
+    void operator()(Writer& w, Enum value) const
+    {
+        int index = static_cast<int>(value);
+
+        // Only a value cast from outside the enumerators gets here, and has no spelling to write
+        if (index < 0 || static_cast<std::size_t>(index) >= EnumTraits<Enum>::count()) {
+            w.Int(index);
+            return;
+        }
+        const EnumSpelling& s = EnumTraits<Enum>::spellings()[index];
+        StringWriter<Writer>()(w, s.name, s.length, s.token, s.token_length);
+    }
+};
+}
+
+#endif
@@ -31,6 +31,8 @@
 #include <rapidjson/error/en.h>
 
 #include <cstddef>
+#include <cstring>
+#include <new>
 #include <vector>
 #include <iterator>
 #include <string>
@@ -52,7 +54,17 @@ namespace error {
                             ARRAY_LENGTH_MISMATCH = 6,
                             UNKNOWN_FIELD = 7,
                             DUPLICATE_KEYS = 8,
-                            CORRUPTED_DOM = 9;
+                            CORRUPTED_DOM = 9,
+                            SCHEMA_MISMATCH = 10,
+                            STRING_LENGTH = 11,
+                            VALUE_OUT_OF_BOUNDS = 12,
+                            ITEM_COUNT = 13,
+                            DUPLICATE_ITEMS = 14,
+                            PATTERN_MISMATCH = 15,
+                            ENUM_MISMATCH = 16,
+                            UNKNOWN_ENUM_VALUE = 17,
+                            UNKNOWN_ALTERNATIVE = 18,
+                            FORMAT_MISMATCH = 19;
 
     class ErrorStack;
 
@@ -60,6 +72,144 @@ namespace error {
         class error_stack_const_iterator;
     }
 
+    // The memory of the errors on a stack. It is kept when the stack is cleared,
+    // so that parsing repeatedly with the same result stops allocating for errors.
+    class ErrorArena {
+    private:
+        struct Chunk {
+            Chunk* next;
+            std::size_t size;
+        };
+
+        static const std::size_t chunk_size = 1024;
+        static const std::size_t alignment = 8;
+
+        Chunk* m_first;
+        Chunk* m_current;
+        std::size_t m_used;
+
+        ErrorArena(const ErrorArena&);
+        ErrorArena& operator=(const ErrorArena&);
+
+    public:
+        explicit ErrorArena()
+            : m_first(0)
+            , m_current(0)
+            , m_used(0)
+        {
+        }
+
+        ~ErrorArena()
+        {
+            while (m_first) {
+                Chunk* next = m_first->next;
+                ::operator delete(m_first);
+                m_first = next;
+            }
+        }
+
+        void* allocate(std::size_t size)
+        {
+            size = (size + alignment - 1) / alignment * alignment;
+
+            while (m_current && m_used + size > m_current->size && m_current->next) {
+                m_current = m_current->next;
+                m_used = 0;
+            }
+
+            if (!m_current || m_used + size > m_current->size) {
+                std::size_t capacity = size > chunk_size ? size : chunk_size;
+                Chunk* c = static_cast<Chunk*>(::operator new(sizeof(Chunk) + capacity));
+                c->next = 0;
+                c->size = capacity;
+                if (m_current)
+                    m_current->next = c;
+                else
+                    m_first = c;
+                m_current = c;
+                m_used = 0;
+            }
+
+            void* result = reinterpret_cast<char*>(m_current + 1) + m_used;
+            m_used += size;
+            return result;
+        }
+
+        // Makes all the memory available again
+        void rewind() AUTOJSONCXX_NOEXCEPT
+        {
+            m_current = m_first;
+            m_used = 0;
+        }
+
+        void swap(ErrorArena& other) AUTOJSONCXX_NOEXCEPT
+        {
+            std::swap(m_first, other.m_first);
+            std::swap(m_current, other.m_current);
+            std::swap(m_used, other.m_used);
+        }
+    };
+
+    // A piece of text carried by an error. A null terminated string is assumed to outlive the error,
+    // such as a literal emitted by the generator; a string with a length is copied into the arena
+    // when the error is pushed onto a stack.
+    class ErrorText {
+    private:
+        const char* m_data;
+        std::size_t m_length;
+        bool m_stable;
+
+    public:
+        ErrorText(const char* stable)
+            : m_data(stable)
+            , m_length(std::strlen(stable))
+            , m_stable(true)
+        {
+        }
+
+        explicit ErrorText(const char* data, std::size_t length)
+            : m_data(data)
+            , m_length(length)
+            , m_stable(false)
+        {
+        }
+
+        std::string str() const
+        {
+            return std::string(m_data, m_length);
+        }
+
+        // Null terminated once copied to a stack
+        const char* data() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_data;
+        }
+
+        ErrorText copy_to(ErrorStack& errs) const;
+    };
+
+    // Keeps the text of a rejected value for the error that carries it, as the string of the reader
+    // is gone when the error is reaped. Error codes carry no text, so then nothing is copied.
+    class RejectedText {
+#ifdef AUTOJSONCXX_ENABLE_ERROR_CODES
+    public:
+        ErrorText keep(const char* data, std::size_t length)
+        {
+            return ErrorText(data, length);
+        }
+#else
+    private:
+        std::string m_text;
+
+    public:
+        ErrorText keep(const char* data, std::size_t length)
+        {
+            m_text.assign(data, length);
+            return ErrorText(m_text.data(), m_text.size());
+        }
+#endif
+    };
+
     class ErrorBase {
     protected:
         explicit ErrorBase()
@@ -67,6 +217,8 @@ namespace error {
         {
         }
 
+        static void* allocate(ErrorStack& errs, std::size_t size);
+
     private:
         ErrorBase* next;
 
@@ -81,10 +233,16 @@ namespace error {
         }
         virtual ~ErrorBase() {}
         virtual std::string description() const = 0;
+
+        // Copies this error into the arena of `errs`, without pushing it.
+        // Errors that do not override it are copied as a `CopiedError`, keeping their type and description.
+        virtual ErrorBase* copy_to(ErrorStack& errs) const;
     };
 
     class Success : public ErrorBase {
     public:
+        static const error_type code = SUCCESS;
+
         explicit Success()
         {
         }
@@ -96,6 +254,10 @@ namespace error {
         {
             return SUCCESS;
         }
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(Success))) Success();
+        }
     };
 
     class IntermediateError : public ErrorBase {
@@ -108,17 +270,19 @@ namespace error {
 
     class ObjectMemberError : public IntermediateError {
     private:
-        std::string m_member_name;
+        ErrorText m_member_name;
 
     public:
-        explicit ObjectMemberError(std::string memberName)
+        static const error_type code = OBJECT_MEMBER;
+
+        explicit ObjectMemberError(ErrorText memberName)
+            : m_member_name(memberName)
         {
-            m_member_name.swap(memberName);
         }
 
-        const std::string& member_name() const
+        std::string member_name() const
         {
-            return m_member_name;
+            return m_member_name.str();
         }
 
         std::string description() const
@@ -130,6 +294,11 @@ namespace error {
         {
             return OBJECT_MEMBER;
         }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(ObjectMemberError))) ObjectMemberError(m_member_name.copy_to(errs));
+        }
     };
 
     class ArrayElementError : public IntermediateError {
@@ -137,6 +306,8 @@ namespace error {
         std::size_t m_index;
 
     public:
+        static const error_type code = ARRAY_ELEMENT;
+
         explicit ArrayElementError(std::size_t idx)
             : m_index(idx)
         {
@@ -158,35 +329,94 @@ namespace error {
         {
             return ARRAY_ELEMENT;
         }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(ArrayElementError))) ArrayElementError(m_index);
+        }
     };
 
     class RequiredFieldMissingError : public ErrorBase {
     private:
-        std::vector<std::string> m_missing_members;
+        struct MissingMember {
+            const char* name;
+            MissingMember* next;
+        };
+
+        MissingMember* m_first;
+        MissingMember* m_last;
+
+        // Built from the list only when asked for, after which it holds the names instead
+        mutable std::vector<std::string>* m_names;
+
+        RequiredFieldMissingError(const RequiredFieldMissingError&);
+        RequiredFieldMissingError& operator=(const RequiredFieldMissingError&);
+
+        std::vector<std::string>& names() const
+        {
+            if (!m_names) {
+                m_names = new std::vector<std::string>();
+                for (const MissingMember* m = m_first; m; m = m->next)
+                    m_names->push_back(m->name);
+            }
+            return *m_names;
+        }
 
     public:
+        static const error_type code = MISSING_REQUIRED;
+
         explicit RequiredFieldMissingError()
+            : m_first(0)
+            , m_last(0)
+            , m_names(0)
+        {
+        }
+
+        ~RequiredFieldMissingError()
         {
+            delete m_names;
+        }
+
+        // The name is allocated from the arena of `errs`, and must outlive the error,
+        // such as a literal emitted by the generator
+        void add_missing_member(ErrorStack& errs, const char* name)
+        {
+            MissingMember* m = static_cast<MissingMember*>(allocate(errs, sizeof(MissingMember)));
+            m->name = name;
+            m->next = 0;
+            if (m_last)
+                m_last->next = m;
+            else
+                m_first = m;
+            m_last = m;
+            if (m_names)
+                m_names->push_back(name);
         }
 
         std::vector<std::string>& missing_members()
         {
-            return m_missing_members;
-        };
+            return names();
+        }
 
         const std::vector<std::string>& missing_members() const
         {
-            return m_missing_members;
+            return names();
         }
 
         std::string description() const
         {
             std::string result = "Missing required field(s): ";
 
-            typedef std::vector<std::string>::const_iterator iter;
-            for (iter it = m_missing_members.begin(), end = m_missing_members.end();
-                 it != end; ++it) {
-                result += utility::quote(*it);
+            if (m_names) {
+                typedef std::vector<std::string>::const_iterator iter;
+                for (iter it = m_names->begin(), end = m_names->end(); it != end; ++it) {
+                    result += utility::quote(*it);
+                    result += ' ';
+                }
+                return result;
+            }
+            for (const MissingMember* m = m_first; m; m = m->next) {
+                result += utility::quote(m->name);
                 result += ' ';
             }
             return result;
@@ -196,26 +426,44 @@ namespace error {
         {
             return MISSING_REQUIRED;
         }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            RequiredFieldMissingError* copy = new (allocate(errs, sizeof(RequiredFieldMissingError))) RequiredFieldMissingError();
+            if (m_names) {
+                // The names may have been changed through `missing_members()`, and no longer be literals
+                typedef std::vector<std::string>::const_iterator iter;
+                for (iter it = m_names->begin(), end = m_names->end(); it != end; ++it)
+                    copy->add_missing_member(errs, ErrorText(it->data(), it->size()).copy_to(errs).data());
+                return copy;
+            }
+            for (const MissingMember* m = m_first; m; m = m->next)
+                copy->add_missing_member(errs, m->name);
+            return copy;
+        }
     };
 
+    // The names of types are literals
     class TypeMismatchError : public ErrorBase {
     private:
-        std::string m_expected_type;
-        std::string m_actual_type;
+        const char* m_expected_type;
+        const char* m_actual_type;
 
     public:
-        explicit TypeMismatchError(std::string expectedType, std::string actualType)
+        static const error_type code = TYPE_MISMATCH;
+
+        explicit TypeMismatchError(const char* expectedType, const char* actualType)
+            : m_expected_type(expectedType)
+            , m_actual_type(actualType)
         {
-            m_expected_type.swap(expectedType);
-            m_actual_type.swap(actualType);
         }
 
-        const std::string& expected_type() const
+        std::string expected_type() const
         {
             return m_expected_type;
         }
 
-        const std::string& actual_type() const
+        std::string actual_type() const
         {
             return m_actual_type;
         }
@@ -231,169 +479,727 @@ namespace error {
         {
             return TYPE_MISMATCH;
         }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(TypeMismatchError))) TypeMismatchError(m_expected_type, m_actual_type);
+        }
+    };
+
+    // The names of types are literals
+    class NumberOutOfRangeError : public ErrorBase {
+        const char* m_expected_type;
+        const char* m_actual_type;
+
+    public:
+        static const error_type code = NUMBER_OUT_OF_RANGE;
+
+        explicit NumberOutOfRangeError(const char* expectedType, const char* actualType)
+            : m_expected_type(expectedType)
+            , m_actual_type(actualType)
+        {
+        }
+
+        std::string expected_type() const
+        {
+            return m_expected_type;
+        }
+
+        std::string actual_type() const
+        {
+            return m_actual_type;
+        }
+
+        std::string description() const
+        {
+            return std::string("Number out of range: expected type ")
+                   + utility::quote(expected_type())
+                   + " but the type needed is " + utility::quote(actual_type());
+        }
+
+        error_type type() const
+        {
+            return NUMBER_OUT_OF_RANGE;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(NumberOutOfRangeError))) NumberOutOfRangeError(m_expected_type, m_actual_type);
+        }
+    };
+
+    class DuplicateKeyError : public ErrorBase {
+    private:
+        ErrorText key_name;
+
+    public:
+        static const error_type code = DUPLICATE_KEYS;
+
+        explicit DuplicateKeyError(ErrorText name)
+            : key_name(name)
+        {
+        }
+
+        std::string key() const
+        {
+            return key_name.str();
+        }
+
+        error_type type() const
+        {
+            return DUPLICATE_KEYS;
+        }
+
+        std::string description() const
+        {
+            return "Duplicate key in uniquely keyed map type: " + utility::quote(key());
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(DuplicateKeyError))) DuplicateKeyError(key_name.copy_to(errs));
+        }
+    };
+
+    class ArrayLengthMismatchError : public ErrorBase {
+    private:
+        std::size_t m_expected_length;
+        std::size_t m_actual_length;
+
+    public:
+        static const error_type code = ARRAY_LENGTH_MISMATCH;
+
+        explicit ArrayLengthMismatchError(std::size_t expectedLength, std::size_t actualLength)
+            : m_expected_length(expectedLength)
+            , m_actual_length(actualLength)
+        {
+        }
+
+        std::size_t expected_length() const
+        {
+            return m_expected_length;
+        }
+
+        std::size_t actual_length() const
+        {
+            return m_actual_length;
+        }
+
+        std::string description() const
+        {
+            std::ostringstream ss;
+            ss << "Array length mismatch between expected length "
+               << expected_length() << " and actual length "
+               << actual_length();
+            return ss.str();
+        }
+
+        error_type type() const
+        {
+            return ARRAY_LENGTH_MISMATCH;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(ArrayLengthMismatchError))) ArrayLengthMismatchError(m_expected_length, m_actual_length);
+        }
+    };
+
+    class UnknownFieldError : public ErrorBase {
+    private:
+        ErrorText m_name;
+
+    public:
+        static const error_type code = UNKNOWN_FIELD;
+
+        explicit UnknownFieldError(ErrorText name)
+            : m_name(name)
+        {
+        }
+
+        explicit UnknownFieldError(const char* name, std::size_t length)
+            : m_name(name, length)
+        {
+        }
+
+        std::string field_name() const
+        {
+            return m_name.str();
+        }
+
+        error_type type() const
+        {
+            return UNKNOWN_FIELD;
+        }
+
+        std::string description() const
+        {
+            return "Unknown field with name: " + utility::quote(field_name());
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(UnknownFieldError))) UnknownFieldError(m_name.copy_to(errs));
+        }
+    };
+
+    class CorruptedDOMError : public ErrorBase {
+    private:
+        ErrorText m_msg;
+
+    public:
+        static const error_type code = CORRUPTED_DOM;
+
+        explicit CorruptedDOMError(ErrorText msg)
+            : m_msg(msg)
+        {
+        }
+
+        std::string description() const
+        {
+            return m_msg.str();
+        }
+
+        error_type type() const
+        {
+            return CORRUPTED_DOM;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(CorruptedDOMError))) CorruptedDOMError(m_msg.copy_to(errs));
+        }
+    };
+
+    class SchemaMismatchError : public ErrorBase {
+    private:
+        utility::uint64_t m_expected;
+        utility::uint64_t m_actual;
+
+    public:
+        static const error_type code = SCHEMA_MISMATCH;
+
+        explicit SchemaMismatchError(utility::uint64_t expected, utility::uint64_t actual)
+            : m_expected(expected)
+            , m_actual(actual)
+        {
+        }
+
+        utility::uint64_t expected_fingerprint() const
+        {
+            return m_expected;
+        }
+
+        utility::uint64_t actual_fingerprint() const
+        {
+            return m_actual;
+        }
+
+        std::string description() const
+        {
+            std::ostringstream ss;
+            ss << "Schema mismatch between expected fingerprint " << std::hex << expected_fingerprint()
+               << " and actual fingerprint " << actual_fingerprint();
+            return ss.str();
+        }
+
+        error_type type() const
+        {
+            return SCHEMA_MISMATCH;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(SchemaMismatchError))) SchemaMismatchError(m_expected, m_actual);
+        }
+    };
+
+    // Base of the errors raised when a member violates a constraint of the definition file.
+    // The member name is a literal emitted by the generator.
+    class ConstraintViolationError : public ErrorBase {
+    private:
+        const char* m_member_name;
+
+    protected:
+        explicit ConstraintViolationError(const char* memberName)
+            : m_member_name(memberName)
+        {
+        }
+
+        const char* member_literal() const
+        {
+            return m_member_name;
+        }
+
+    public:
+        std::string member_name() const
+        {
+            return m_member_name;
+        }
+    };
+
+    namespace internal {
+        // Writes a range like "[1, 20]", where the maximum of the type means unbounded
+        template <class T>
+        void write_bounds(std::ostream& os, T minimum, T maximum, T unbounded)
+        {
+            os << '[' << minimum << ", ";
+            if (maximum == unbounded)
+                os << "inf)";
+            else
+                os << maximum << ']';
+        }
+    }
+
+    // From `minLength` and `maxLength`; the length counts code points
+    class StringLengthError : public ConstraintViolationError {
+    private:
+        std::size_t m_length;
+        std::size_t m_min_length;
+        std::size_t m_max_length;
+
+    public:
+        static const error_type code = STRING_LENGTH;
+
+        explicit StringLengthError(const char* memberName, std::size_t length, std::size_t minLength, std::size_t maxLength)
+            : ConstraintViolationError(memberName)
+            , m_length(length)
+            , m_min_length(minLength)
+            , m_max_length(maxLength)
+        {
+        }
+
+        std::size_t length() const
+        {
+            return m_length;
+        }
+
+        std::size_t min_length() const
+        {
+            return m_min_length;
+        }
+
+        // `std::size_t(-1)` when unbounded
+        std::size_t max_length() const
+        {
+            return m_max_length;
+        }
+
+        std::string description() const
+        {
+            std::ostringstream ss;
+            ss << "String length " << m_length << " of member " << utility::quote(member_name())
+               << " is out of range ";
+            internal::write_bounds(ss, m_min_length, m_max_length, static_cast<std::size_t>(-1));
+            return ss.str();
+        }
+
+        error_type type() const
+        {
+            return STRING_LENGTH;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(StringLengthError))) StringLengthError(member_literal(), m_length, m_min_length, m_max_length);
+        }
+    };
+
+    // From `minimum` and `maximum`
+    class ValueOutOfBoundsError : public ConstraintViolationError {
+    private:
+        double m_value;
+        double m_minimum;
+        double m_maximum;
+
+    public:
+        static const error_type code = VALUE_OUT_OF_BOUNDS;
+
+        explicit ValueOutOfBoundsError(const char* memberName, double value, double minimum, double maximum)
+            : ConstraintViolationError(memberName)
+            , m_value(value)
+            , m_minimum(minimum)
+            , m_maximum(maximum)
+        {
+        }
+
+        double value() const
+        {
+            return m_value;
+        }
+
+        // Infinite when unbounded
+        double minimum() const
+        {
+            return m_minimum;
+        }
+
+        double maximum() const
+        {
+            return m_maximum;
+        }
+
+        std::string description() const
+        {
+            std::ostringstream ss;
+            ss << "Value " << m_value << " of member " << utility::quote(member_name())
+               << " is out of range [" << m_minimum << ", " << m_maximum << ']';
+            return ss.str();
+        }
+
+        error_type type() const
+        {
+            return VALUE_OUT_OF_BOUNDS;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(ValueOutOfBoundsError))) ValueOutOfBoundsError(member_literal(), m_value, m_minimum, m_maximum);
+        }
+    };
+
+    // From `minItems` and `maxItems`
+    class ItemCountError : public ConstraintViolationError {
+    private:
+        std::size_t m_count;
+        std::size_t m_min_items;
+        std::size_t m_max_items;
+
+    public:
+        static const error_type code = ITEM_COUNT;
+
+        explicit ItemCountError(const char* memberName, std::size_t count, std::size_t minItems, std::size_t maxItems)
+            : ConstraintViolationError(memberName)
+            , m_count(count)
+            , m_min_items(minItems)
+            , m_max_items(maxItems)
+        {
+        }
+
+        std::size_t count() const
+        {
+            return m_count;
+        }
+
+        std::size_t min_items() const
+        {
+            return m_min_items;
+        }
+
+        // `std::size_t(-1)` when unbounded
+        std::size_t max_items() const
+        {
+            return m_max_items;
+        }
+
+        std::string description() const
+        {
+            std::ostringstream ss;
+            ss << "Item count " << m_count << " of member " << utility::quote(member_name())
+               << " is out of range ";
+            internal::write_bounds(ss, m_min_items, m_max_items, static_cast<std::size_t>(-1));
+            return ss.str();
+        }
+
+        error_type type() const
+        {
+            return ITEM_COUNT;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(ItemCountError))) ItemCountError(member_literal(), m_count, m_min_items, m_max_items);
+        }
+    };
+
+    // From `uniqueItems`
+    class DuplicateItemsError : public ConstraintViolationError {
+    private:
+        std::size_t m_index;
+
+    public:
+        static const error_type code = DUPLICATE_ITEMS;
+
+        explicit DuplicateItemsError(const char* memberName, std::size_t index)
+            : ConstraintViolationError(memberName)
+            , m_index(index)
+        {
+        }
+
+        // The index of the first item equal to an earlier one
+        std::size_t index() const
+        {
+            return m_index;
+        }
+
+        std::string description() const
+        {
+            std::ostringstream ss;
+            ss << "Item with index " << m_index << " of member " << utility::quote(member_name())
+               << " duplicates an earlier item";
+            return ss.str();
+        }
+
+        error_type type() const
+        {
+            return DUPLICATE_ITEMS;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(DuplicateItemsError))) DuplicateItemsError(member_literal(), m_index);
+        }
+    };
+
+    // From `pattern`; the pattern is a literal
+    class PatternMismatchError : public ConstraintViolationError {
+    private:
+        const char* m_pattern;
+
+    public:
+        static const error_type code = PATTERN_MISMATCH;
+
+        explicit PatternMismatchError(const char* memberName, const char* pattern)
+            : ConstraintViolationError(memberName)
+            , m_pattern(pattern)
+        {
+        }
+
+        std::string pattern() const
+        {
+            return m_pattern;
+        }
+
+        std::string description() const
+        {
+            return "Member " + utility::quote(member_name()) + " does not match the pattern " + utility::quote(pattern());
+        }
+
+        error_type type() const
+        {
+            return PATTERN_MISMATCH;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(PatternMismatchError))) PatternMismatchError(member_literal(), m_pattern);
+        }
     };
 
-    class NumberOutOfRangeError : public ErrorBase {
-        std::string m_expected_type;
-        std::string m_actual_type;
+    // From `enum`; the value is only recorded for strings
+    class EnumMismatchError : public ConstraintViolationError {
+    private:
+        ErrorText m_value;
 
     public:
-        explicit NumberOutOfRangeError(std::string expectedType, std::string actualType)
-        {
-            m_expected_type.swap(expectedType);
-            m_actual_type.swap(actualType);
-        }
+        static const error_type code = ENUM_MISMATCH;
 
-        const std::string& expected_type() const
+        explicit EnumMismatchError(const char* memberName, ErrorText value = ErrorText(""))
+            : ConstraintViolationError(memberName)
+            , m_value(value)
         {
-            return m_expected_type;
         }
 
-        const std::string& actual_type() const
+        std::string value() const
         {
-            return m_actual_type;
+            return m_value.str();
         }
 
         std::string description() const
         {
-            return std::string("Number out of range: expected type ")
-                   + utility::quote(expected_type())
-                   + " but the type needed is " + utility::quote(actual_type());
+            std::string result = "Member " + utility::quote(member_name()) + " is not one of the allowed values";
+            std::string v = value();
+            if (!v.empty())
+                result += ": " + utility::quote(v);
+            return result;
         }
 
         error_type type() const
         {
-            return NUMBER_OUT_OF_RANGE;
+            return ENUM_MISMATCH;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(EnumMismatchError))) EnumMismatchError(member_literal(), m_value.copy_to(errs));
         }
     };
 
-    class DuplicateKeyError : public ErrorBase {
+    // The name of the enum is a literal
+    class UnknownEnumValueError : public ErrorBase {
     private:
-        std::string key_name;
+        const char* m_enum_name;
+        ErrorText m_value;
 
     public:
-        explicit DuplicateKeyError(const std::string& name)
-            : key_name(name)
+        static const error_type code = UNKNOWN_ENUM_VALUE;
+
+        explicit UnknownEnumValueError(const char* enumName, ErrorText value)
+            : m_enum_name(enumName)
+            , m_value(value)
         {
         }
 
-#if AUTOJSONCXX_HAS_RVALUE
+        std::string enum_name() const
+        {
+            return m_enum_name;
+        }
 
-        explicit DuplicateKeyError(std::string&& name)
-            : key_name(AUTOJSONCXX_MOVE(name))
+        std::string value() const
         {
+            return m_value.str();
         }
-#endif
 
-        const std::string& key() const
+        std::string description() const
         {
-            return key_name;
+            return "Unknown value " + utility::quote(value()) + " of enum " + utility::quote(enum_name());
         }
 
         error_type type() const
         {
-            return DUPLICATE_KEYS;
+            return UNKNOWN_ENUM_VALUE;
         }
 
-        std::string description() const
+        ErrorBase* copy_to(ErrorStack& errs) const
         {
-            return "Duplicate key in uniquely keyed map type: " + utility::quote(key());
+            return new (allocate(errs, sizeof(UnknownEnumValueError))) UnknownEnumValueError(m_enum_name, m_value.copy_to(errs));
         }
     };
 
-    class ArrayLengthMismatchError : public ErrorBase {
+    // The value of the discriminator of a tagged union matches none of its alternatives.
+    // The name of the union is a literal.
+    class UnknownAlternativeError : public ErrorBase {
     private:
-        std::size_t m_expected_length;
-        std::size_t m_actual_length;
+        const char* m_union_name;
+        ErrorText m_tag;
 
     public:
-        explicit ArrayLengthMismatchError(std::size_t expectedLength, std::size_t actualLength)
-            : m_expected_length(expectedLength)
-            , m_actual_length(actualLength)
+        static const error_type code = UNKNOWN_ALTERNATIVE;
+
+        explicit UnknownAlternativeError(const char* unionName, ErrorText tag)
+            : m_union_name(unionName)
+            , m_tag(tag)
         {
         }
 
-        std::size_t expected_length() const
+        std::string union_name() const
         {
-            return m_expected_length;
+            return m_union_name;
         }
 
-        std::size_t actual_length() const
+        std::string tag() const
         {
-            return m_actual_length;
+            return m_tag.str();
         }
 
         std::string description() const
         {
-            std::ostringstream ss;
-            ss << "Array length mismatch between expected length "
-               << expected_length() << " and actual length "
-               << actual_length();
-            return ss.str();
+            return "Unknown alternative " + utility::quote(tag()) + " of tagged union " + utility::quote(union_name());
         }
 
         error_type type() const
         {
-            return ARRAY_LENGTH_MISMATCH;
+            return UNKNOWN_ALTERNATIVE;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(UnknownAlternativeError))) UnknownAlternativeError(m_union_name, m_tag.copy_to(errs));
         }
     };
 
-    class UnknownFieldError : public ErrorBase {
+    // A string that is not in the format of a compact type, such as a uuid or an IP address.
+    // The name of the format is a literal.
+    class FormatMismatchError : public ErrorBase {
     private:
-        std::string m_name;
+        const char* m_format;
+        ErrorText m_value;
 
     public:
-        explicit UnknownFieldError(const char* name, std::size_t length)
-            : m_name(name, length)
+        static const error_type code = FORMAT_MISMATCH;
+
+        explicit FormatMismatchError(const char* format, ErrorText value)
+            : m_format(format)
+            , m_value(value)
         {
         }
 
-        const std::string& field_name() const
+        std::string format() const
         {
-            return m_name;
+            return m_format;
         }
 
-        error_type type() const
+        std::string value() const
         {
-            return UNKNOWN_FIELD;
+            return m_value.str();
         }
 
         std::string description() const
         {
-            return "Unknown field with name: " + utility::quote(field_name());
+            return "The string " + utility::quote(value()) + " is not a valid " + format();
+        }
+
+        error_type type() const
+        {
+            return FORMAT_MISMATCH;
+        }
+
+        ErrorBase* copy_to(ErrorStack& errs) const
+        {
+            return new (allocate(errs, sizeof(FormatMismatchError))) FormatMismatchError(m_format, m_value.copy_to(errs));
         }
     };
 
-    class CorruptedDOMError : public ErrorBase {
+    // The copy of an error whose class does not override `copy_to`
+    class CopiedError : public ErrorBase {
     private:
-        std::string m_msg;
+        error_type m_type;
+        bool m_intermediate;
+        ErrorText m_description;
 
     public:
-        explicit CorruptedDOMError(std::string msg)
+        explicit CopiedError(error_type type, bool intermediate, ErrorText description)
+            : m_type(type)
+            , m_intermediate(intermediate)
+            , m_description(description)
+        {
+        }
+
+        error_type type() const
         {
-            m_msg.swap(msg);
+            return m_type;
+        }
+
+        bool is_intermediate() const
+        {
+            return m_intermediate;
         }
 
         std::string description() const
         {
-            return m_msg;
+            return m_description.str();
         }
 
-        error_type type() const
+        ErrorBase* copy_to(ErrorStack& errs) const
         {
-            return CORRUPTED_DOM;
+            return new (allocate(errs, sizeof(CopiedError))) CopiedError(m_type, m_intermediate, m_description.copy_to(errs));
         }
     };
 
     namespace internal {
 
-        class error_stack_const_iterator : public std::iterator<std::forward_iterator_tag, const ErrorBase> {
+        class error_stack_const_iterator {
         private:
             const ErrorBase* e;
 
-            typedef std::iterator<std::forward_iterator_tag, const ErrorBase> base_type;
-
         public:
+            // Spelled out, as deriving from `std::iterator` is deprecated in C++17
+            typedef std::forward_iterator_tag iterator_category;
+            typedef const ErrorBase value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const ErrorBase* pointer;
+            typedef const ErrorBase& reference;
+
             explicit error_stack_const_iterator(const ErrorBase* p)
                 : e(p)
             {
@@ -426,10 +1232,100 @@ namespace error {
         };
     }
 
+#ifdef AUTOJSONCXX_ENABLE_ERROR_CODES
+
+    // Keeps only the type of the innermost error, so that failing never allocates.
+    // Iteration yields nothing; query `innermost_type()` and the offset of the parsing result instead.
+    class ErrorStack {
+    private:
+        error_type m_type;
+        ErrorArena m_arena;
+
+        ErrorStack(const ErrorStack&);
+        ErrorStack& operator=(const ErrorStack&);
+
+    public:
+        typedef internal::error_stack_const_iterator const_iterator;
+
+        explicit ErrorStack()
+            : m_type(SUCCESS)
+        {
+        }
+
+        const_iterator begin() const AUTOJSONCXX_NOEXCEPT
+        {
+            return const_iterator(0);
+        }
+
+        const_iterator end() const AUTOJSONCXX_NOEXCEPT
+        {
+            return const_iterator(0);
+        }
+
+        ErrorBase* push_copy(const ErrorBase& e)
+        {
+            m_type = e.type();
+            return 0;
+        }
+
+        void push(ErrorBase* e)
+        {
+            if (e) {
+                m_type = e->type();
+                delete e;
+            }
+        }
+
+        void push_type(error_type type)
+        {
+            m_type = type;
+        }
+
+        void pop()
+        {
+            m_type = SUCCESS;
+        }
+
+        void clear()
+        {
+            m_type = SUCCESS;
+        }
+
+        bool empty() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_type == SUCCESS;
+        }
+
+        std::size_t size() const AUTOJSONCXX_NOEXCEPT
+        {
+            return empty() ? 0 : 1;
+        }
+
+        error_type innermost_type() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_type;
+        }
+
+        ErrorArena& arena()
+        {
+            return m_arena;
+        }
+
+        void swap(ErrorStack& other) AUTOJSONCXX_NOEXCEPT
+        {
+            std::swap(m_type, other.m_type);
+            m_arena.swap(other.m_arena);
+        }
+    };
+
+#else
+
+    // A stack of errors chained through themselves, allocated from an arena owned by the stack
     class ErrorStack {
     private:
         ErrorBase* head;
         std::size_t m_size;
+        ErrorArena m_arena;
 
         ErrorStack(const ErrorStack&);
         ErrorStack& operator=(const ErrorStack&);
@@ -453,28 +1349,42 @@ namespace error {
             return const_iterator(0);
         }
 
+        // Pushes a copy of e in the arena, and returns the copy
+        ErrorBase* push_copy(const ErrorBase& e)
+        {
+            ErrorBase* copy = e.copy_to(*this);
+            copy->next = head;
+            head = copy;
+            ++m_size;
+            return copy;
+        }
+
         // This will take the ownership of e
         // Requires it to be dynamically allocated
         void push(ErrorBase* e)
         {
             if (e) {
-                e->next = head;
-                head = e;
-                ++m_size;
+                utility::scoped_ptr<ErrorBase> guard(e);
+                push_copy(*e);
             }
         }
 
-        // The caller will take the responsibility of deleting the returned pointer
-        // Returns NULL when empty
-        ErrorBase* pop()
+        void pop()
         {
             if (head) {
-                ErrorBase* result = head;
+                ErrorBase* top = head;
                 head = head->next;
                 --m_size;
-                return result;
+                top->~ErrorBase();
             }
-            return 0;
+        }
+
+        // Removes all the errors, keeping the memory of the arena
+        void clear()
+        {
+            while (head)
+                pop();
+            m_arena.rewind();
         }
 
         bool empty() const AUTOJSONCXX_NOEXCEPT
@@ -487,29 +1397,35 @@ namespace error {
             return m_size;
         }
 
+        error_type innermost_type() const AUTOJSONCXX_NOEXCEPT
+        {
+            return head ? head->type() : SUCCESS;
+        }
+
+        ErrorArena& arena()
+        {
+            return m_arena;
+        }
+
         ~ErrorStack()
         {
-            while (head) {
-                ErrorBase* next = head->next;
-                delete head;
-                head = next;
-            }
+            clear();
         }
 
         void swap(ErrorStack& other) AUTOJSONCXX_NOEXCEPT
         {
             std::swap(head, other.head);
             std::swap(m_size, other.m_size);
+            m_arena.swap(other.m_arena);
         }
 
 #if AUTOJSONCXX_HAS_RAVLUE
 
         ErrorStack(ErrorStack&& other)
-            : head(other.head)
-            , m_size(other.m_size)
+            : head(0)
+            , m_size(0)
         {
-            other.head = 0;
-            other.m_size = 0;
+            swap(other);
         }
 
         ErrorStack& operator==(ErrorStack&& other) AUTOJSONCXX_NOEXCEPT
@@ -520,12 +1436,221 @@ namespace error {
 #endif
     };
 
+#endif
+
+    inline void* ErrorBase::allocate(ErrorStack& errs, std::size_t size)
+    {
+        return errs.arena().allocate(size);
+    }
+
+    inline ErrorText ErrorText::copy_to(ErrorStack& errs) const
+    {
+        if (m_stable)
+            return *this;
+        char* copy = static_cast<char*>(errs.arena().allocate(m_length + 1));
+        std::memcpy(copy, m_data, m_length);
+        copy[m_length] = 0;
+        // Still copied again when pushed onto another stack, as the arena may be cleared first
+        return ErrorText(copy, m_length);
+    }
+
+    inline ErrorBase* ErrorBase::copy_to(ErrorStack& errs) const
+    {
+        std::string text = description();
+        ErrorText copied = ErrorText(text.data(), text.size()).copy_to(errs);
+        return new (allocate(errs, sizeof(CopiedError))) CopiedError(type(), is_intermediate(), copied);
+    }
+
     // For argument dependent lookup
     inline void swap(ErrorStack& s1, ErrorStack& s2)
     {
         s1.swap(s2);
     }
 
+#ifdef AUTOJSONCXX_ENABLE_ERROR_CODES
+
+    // Holds the error of a handler until it is moved onto the stack
+    class ErrorHolder {
+    private:
+        error_type m_type;
+
+    public:
+        explicit ErrorHolder()
+            : m_type(SUCCESS)
+        {
+        }
+
+        bool empty() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_type == SUCCESS;
+        }
+
+        error_type type() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_type;
+        }
+
+        template <class Error>
+        void set()
+        {
+            m_type = Error::code;
+        }
+
+        template <class Error, class Arg1>
+        void set(const Arg1&)
+        {
+            m_type = Error::code;
+        }
+
+        template <class Error, class Arg1, class Arg2>
+        void set(const Arg1&, const Arg2&)
+        {
+            m_type = Error::code;
+        }
+
+        template <class Error, class Arg1, class Arg2, class Arg3, class Arg4>
+        void set(const Arg1&, const Arg2&, const Arg3&, const Arg4&)
+        {
+            m_type = Error::code;
+        }
+
+        void reset()
+        {
+            m_type = SUCCESS;
+        }
+
+        // No error object is ever created, so this always returns null
+        ErrorBase* move_to(ErrorStack& errs)
+        {
+            errs.push_type(m_type);
+            m_type = SUCCESS;
+            return 0;
+        }
+    };
+
+#else
+
+    namespace internal {
+        template <bool fits>
+        struct error_fits_in_holder;
+
+        template <>
+        struct error_fits_in_holder<true> {
+        };
+
+        template <std::size_t first, std::size_t second>
+        struct max_size {
+            static const std::size_t value = first < second ? second : first;
+        };
+
+        // The size of the largest error a handler may hold, which every handler pays for
+        struct largest_error {
+            static const std::size_t size = max_size<sizeof(RequiredFieldMissingError),
+                max_size<sizeof(TypeMismatchError),
+                max_size<sizeof(NumberOutOfRangeError),
+                max_size<sizeof(DuplicateKeyError),
+                max_size<sizeof(ArrayLengthMismatchError),
+                max_size<sizeof(UnknownFieldError),
+                max_size<sizeof(CorruptedDOMError),
+                max_size<sizeof(SchemaMismatchError),
+                max_size<sizeof(ConstraintViolationError),
+                max_size<sizeof(UnknownEnumValueError),
+                max_size<sizeof(UnknownAlternativeError), sizeof(FormatMismatchError)>::value>::value>::value>::value>::value>::value>::value>::value>::value>::value>::value;
+        };
+    }
+
+    // Holds the error of a handler in place until it is moved onto the stack,
+    // so that nothing is allocated when a handler fails
+    class ErrorHolder {
+    public:
+        static const std::size_t max_error_size = internal::largest_error::size;
+
+    private:
+        union {
+            void* m_align_pointer;
+            utility::uint64_t m_align_integer;
+            double m_align_double;
+            char m_storage[max_error_size];
+        };
+        ErrorBase* m_error;
+
+        ErrorHolder(const ErrorHolder&);
+        ErrorHolder& operator=(const ErrorHolder&);
+
+        template <class Error>
+        void* prepare()
+        {
+            (void)sizeof(internal::error_fits_in_holder<sizeof(Error) <= max_error_size>);
+            reset();
+            return m_storage;
+        }
+
+    public:
+        explicit ErrorHolder()
+            : m_error(0)
+        {
+        }
+
+        ~ErrorHolder()
+        {
+            reset();
+        }
+
+        bool empty() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_error == 0;
+        }
+
+        error_type type() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_error ? m_error->type() : SUCCESS;
+        }
+
+        template <class Error>
+        void set()
+        {
+            m_error = new (prepare<Error>()) Error();
+        }
+
+        template <class Error, class Arg1>
+        void set(const Arg1& arg1)
+        {
+            m_error = new (prepare<Error>()) Error(arg1);
+        }
+
+        template <class Error, class Arg1, class Arg2>
+        void set(const Arg1& arg1, const Arg2& arg2)
+        {
+            m_error = new (prepare<Error>()) Error(arg1, arg2);
+        }
+
+        template <class Error, class Arg1, class Arg2, class Arg3, class Arg4>
+        void set(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3, const Arg4& arg4)
+        {
+            m_error = new (prepare<Error>()) Error(arg1, arg2, arg3, arg4);
+        }
+
+        void reset()
+        {
+            if (m_error) {
+                m_error->~ErrorBase();
+                m_error = 0;
+            }
+        }
+
+        // Returns the copy on the stack, or null if there is no error
+        ErrorBase* move_to(ErrorStack& errs)
+        {
+            if (!m_error)
+                return 0;
+            ErrorBase* result = errs.push_copy(*m_error);
+            reset();
+            return result;
+        }
+    };
+
+#endif
+
     template <class CharType, class Traits>
     std::basic_ostream<CharType, Traits>& operator<<(std::basic_ostream<CharType, Traits>& out, const ErrorStack& errs)
     {
@@ -558,7 +1683,7 @@ namespace error {
         void set_result(const rapidjson::ParseResult& result_)
         {
             result = result_;
-            ErrorStack().swap(stack);
+            stack.clear();
         }
 
         void set_result(ParseErrorCode err, std::size_t offset)
@@ -661,10 +1786,15 @@ namespace error {
                 << rapidjson::GetParseError_En(result.error_code())
                 << '\n';
 
+#ifdef AUTOJSONCXX_ENABLE_ERROR_CODES
+            if (!result.error_stack().empty())
+                out << "\nError of type " << result.error_stack().innermost_type() << '\n';
+#else
             if (result.error_code() == rapidjson::kParseErrorTermination
                 || !result.error_stack().empty()) {
                 out << "\nTrace back (last call first):\n" << result.error_stack();
             }
+#endif
         }
         return out;
     }
@@ -0,0 +1,206 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef AUTOJSONCXX_ESCAPE_HPP_29A4C106C1B1
+#define AUTOJSONCXX_ESCAPE_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUTOJSONCXX_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(AUTOJSONCXX_NO_RUNTIME_DISPATCH)
+#define AUTOJSONCXX_HAS_AVX2_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace autojsoncxx {
+
+// Append a range of characters to an output stream.
+// Streams that can copy a whole range at once provide an overload next to their definition.
+template <class OutputStream>
+inline void put_range(OutputStream& os, const char* data, std::size_t length)
+{
+    for (std::size_t i = 0; i < length; ++i)
+        os.Put(data[i]);
+}
+
+namespace utility {
+
+    inline bool needs_escape(unsigned char c)
+    {
+        return c < 0x20 || c == '"' || c == '\\';
+    }
+
+    inline unsigned count_trailing_zeros(unsigned mask)
+    {
+#if defined(__GNUC__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        unsigned result = 0;
+        while (!(mask & 1)) {
+            mask >>= 1;
+            ++result;
+        }
+        return result;
+#endif
+    }
+
+    inline std::size_t unescaped_prefix_length_scalar(const char* str, std::size_t length)
+    {
+        std::size_t i = 0;
+        while (i < length && !needs_escape(static_cast<unsigned char>(str[i])))
+            ++i;
+        return i;
+    }
+
+#if AUTOJSONCXX_HAS_SSE2
+
+    inline std::size_t unescaped_prefix_length_sse2(const char* str, std::size_t length)
+    {
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control = _mm_set1_epi8(0x1F);
+
+        std::size_t i = 0;
+        for (; i + 16 <= length; i += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+            __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                                           _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+            if (mask)
+                return i + count_trailing_zeros(mask);
+        }
+        return i + unescaped_prefix_length_scalar(str + i, length - i);
+    }
+
+#endif
+
+#if AUTOJSONCXX_HAS_AVX2_DISPATCH
+
+    __attribute__((target("avx2"))) inline std::size_t unescaped_prefix_length_avx2(const char* str, std::size_t length)
+    {
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i control = _mm256_set1_epi8(0x1F);
+
+        std::size_t i = 0;
+        for (; i + 32 <= length; i += 32) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+            __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)),
+                                              _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, control), control));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(special));
+            if (mask)
+                return i + count_trailing_zeros(mask);
+        }
+        return i + unescaped_prefix_length_scalar(str + i, length - i);
+    }
+
+    inline bool cpu_has_avx2()
+    {
+        static const bool result = __builtin_cpu_supports("avx2");
+        return result;
+    }
+
+#endif
+
+    // Length of the longest prefix of `str` that can be copied into a JSON string verbatim.
+    // The widest vector instructions available at runtime are used for long inputs.
+    inline std::size_t unescaped_prefix_length(const char* str, std::size_t length)
+    {
+        if (length < 16)
+            return unescaped_prefix_length_scalar(str, length);
+#if AUTOJSONCXX_HAS_AVX2_DISPATCH
+        if (length >= 32 && cpu_has_avx2())
+            return unescaped_prefix_length_avx2(str, length);
+#endif
+#if AUTOJSONCXX_HAS_SSE2
+        return unescaped_prefix_length_sse2(str, length);
+#else
+        return unescaped_prefix_length_scalar(str, length);
+#endif
+    }
+
+    // Write a quoted JSON string with the same escaping as `rapidjson::Writer`,
+    // copying the runs that need no escaping in bulk
+    template <class OutputStream>
+    inline void write_escaped_string(OutputStream& os, const char* str, std::size_t length)
+    {
+        static const char hex_digits[] = "0123456789ABCDEF";
+
+        os.Put('"');
+        std::size_t i = 0;
+        while (i < length) {
+            std::size_t clean = unescaped_prefix_length(str + i, length - i);
+            put_range(os, str + i, clean);
+            i += clean;
+            if (i == length)
+                break;
+
+            unsigned char c = static_cast<unsigned char>(str[i++]);
+            os.Put('\\');
+            switch (c) {
+            case '"':
+            case '\\':
+                os.Put(static_cast<char>(c));
+                break;
+            case '\b':
+                os.Put('b');
+                break;
+            case '\f':
+                os.Put('f');
+                break;
+            case '\n':
+                os.Put('n');
+                break;
+            case '\r':
+                os.Put('r');
+                break;
+            case '\t':
+                os.Put('t');
+                break;
+            default:
+                os.Put('u');
+                os.Put('0');
+                os.Put('0');
+                os.Put(hex_digits[c >> 4]);
+                os.Put(hex_digits[c & 0xF]);
+            }
+        }
+        os.Put('"');
+    }
+}
+}
+
+#endif
@@ -0,0 +1,259 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef AUTOJSONCXX_FINGERPRINT_HPP_29A4C106C1B1
+#define AUTOJSONCXX_FINGERPRINT_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/map_types.hpp>
+#include <autojsoncxx/to_json.hpp>
+
+#include <cstddef>
+
+namespace autojsoncxx {
+namespace utility {
+
+    // Streaming implementation of xxHash64 (https://github.com/Cyan4973/xxHash)
+    class XXHash64 {
+    private:
+        static const uint64_t prime1 = 11400714785074694791ULL;
+        static const uint64_t prime2 = 14029467366897019727ULL;
+        static const uint64_t prime3 = 1609587929392839161ULL;
+        static const uint64_t prime4 = 9650029242287828579ULL;
+        static const uint64_t prime5 = 2870177450012600261ULL;
+
+        uint64_t m_acc[4];
+        uint64_t m_seed;
+        uint64_t m_total_length;
+        unsigned char m_stripe[32];
+        std::size_t m_stripe_size;
+
+        static uint64_t rotate_left(uint64_t x, int r)
+        {
+            return (x << r) | (x >> (64 - r));
+        }
+
+        static uint64_t read64(const unsigned char* p)
+        {
+            uint64_t result = 0;
+            for (int i = 7; i >= 0; --i)
+                result = (result << 8) | p[i];
+            return result;
+        }
+
+        static uint64_t read32(const unsigned char* p)
+        {
+            return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8)
+                   | (static_cast<uint64_t>(p[2]) << 16) | (static_cast<uint64_t>(p[3]) << 24);
+        }
+
+        static uint64_t round(uint64_t acc, uint64_t input)
+        {
+            acc += input * prime2;
+            return rotate_left(acc, 31) * prime1;
+        }
+
+        static uint64_t merge_round(uint64_t acc, uint64_t value)
+        {
+            acc ^= round(0, value);
+            return acc * prime1 + prime4;
+        }
+
+        void consume_stripe()
+        {
+            for (int i = 0; i < 4; ++i)
+                m_acc[i] = round(m_acc[i], read64(m_stripe + 8 * i));
+            m_stripe_size = 0;
+        }
+
+    public:
+        explicit XXHash64(uint64_t seed = 0)
+        {
+            reset(seed);
+        }
+
+        void reset(uint64_t seed = 0)
+        {
+            m_seed = seed;
+            m_acc[0] = seed + prime1 + prime2;
+            m_acc[1] = seed + prime2;
+            m_acc[2] = seed;
+            m_acc[3] = seed - prime1;
+            m_total_length = 0;
+            m_stripe_size = 0;
+        }
+
+        void update(unsigned char c)
+        {
+            m_stripe[m_stripe_size++] = c;
+            ++m_total_length;
+            if (m_stripe_size == sizeof(m_stripe))
+                consume_stripe();
+        }
+
+        void update(const char* data, std::size_t length)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+                update(static_cast<unsigned char>(data[i]));
+        }
+
+        uint64_t digest() const
+        {
+            uint64_t h;
+            if (m_total_length >= sizeof(m_stripe)) {
+                h = rotate_left(m_acc[0], 1) + rotate_left(m_acc[1], 7)
+                    + rotate_left(m_acc[2], 12) + rotate_left(m_acc[3], 18);
+                for (int i = 0; i < 4; ++i)
+                    h = merge_round(h, m_acc[i]);
+            } else {
+                h = m_seed + prime5;
+            }
+            h += m_total_length;
+
+            const unsigned char* p = m_stripe;
+            const unsigned char* end = m_stripe + m_stripe_size;
+            for (; p + 8 <= end; p += 8) {
+                h ^= round(0, read64(p));
+                h = rotate_left(h, 27) * prime1 + prime4;
+            }
+            if (p + 4 <= end) {
+                h ^= read32(p) * prime1;
+                h = rotate_left(h, 23) * prime2 + prime3;
+                p += 4;
+            }
+            for (; p < end; ++p) {
+                h ^= (*p) * prime5;
+                h = rotate_left(h, 11) * prime1;
+            }
+
+            h ^= h >> 33;
+            h *= prime2;
+            h ^= h >> 29;
+            h *= prime3;
+            h ^= h >> 32;
+            return h;
+        }
+    };
+}
+
+// An output stream that feeds every character into a hasher instead of storing it
+template <class Hasher>
+class HashingOutputStream {
+private:
+    Hasher m_hasher;
+
+public:
+    typedef char Ch;
+
+    explicit HashingOutputStream()
+        : m_hasher()
+    {
+    }
+
+    void Put(char c)
+    {
+        m_hasher.update(static_cast<unsigned char>(c));
+    }
+
+    void Flush()
+    {
+    }
+
+    Hasher& hasher() AUTOJSONCXX_NOEXCEPT
+    {
+        return m_hasher;
+    }
+
+    const Hasher& hasher() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_hasher;
+    }
+};
+
+namespace internal {
+    // Base class to construct the stream before the writer that refers to it
+    template <class Hasher>
+    struct hashing_stream_holder {
+        HashingOutputStream<Hasher> stream;
+    };
+}
+
+// A writer that hashes the compact JSON text as it is generated, without materializing it.
+// The members of unordered maps are written in the order of their keys,
+// so that equal values always have the same fingerprint.
+template <class Hasher = utility::XXHash64>
+class HashingWriter : private internal::hashing_stream_holder<Hasher>,
+                      public KeyTokenWriter<HashingOutputStream<Hasher> > {
+private:
+    typedef internal::hashing_stream_holder<Hasher> holder_type;
+    typedef KeyTokenWriter<HashingOutputStream<Hasher> > base_type;
+
+public:
+    explicit HashingWriter()
+        : holder_type()
+        , base_type(holder_type::stream)
+    {
+    }
+
+    Hasher& hasher() AUTOJSONCXX_NOEXCEPT
+    {
+        return holder_type::stream.hasher();
+    }
+
+    const Hasher& hasher() const AUTOJSONCXX_NOEXCEPT
+    {
+        return holder_type::stream.hasher();
+    }
+};
+
+namespace utility {
+    namespace traits {
+        template <class Hasher>
+        struct is_canonical_writer<HashingWriter<Hasher> > : public true_type {
+        };
+
+        template <class Hasher>
+        struct accepts_key_tokens<HashingWriter<Hasher> > : public true_type {
+        };
+
+        template <class Hasher>
+        struct accepts_raw_numbers<HashingWriter<Hasher> > : public true_type {
+        };
+
+        template <class Hasher>
+        struct accepts_string_tokens<HashingWriter<Hasher> > : public true_type {
+        };
+    }
+}
+
+template <class ValueType>
+inline utility::uint64_t json_fingerprint(const ValueType& v)
+{
+    HashingWriter<> w;
+    write_json(w, v);
+    return w.hasher().digest();
+}
+}
+
+#endif
@@ -0,0 +1,1042 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef AUTOJSONCXX_FORMAT_TYPES_HPP_29A4C106C1B1
+#define AUTOJSONCXX_FORMAT_TYPES_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/escape.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if AUTOJSONCXX_HAS_MODERN_TYPES
+#include <chrono>
+#endif
+
+namespace autojsoncxx {
+
+// A UUID as its 16 bytes, written as 32 lowercase hexadecimal digits grouped 8-4-4-4-12
+struct uuid {
+    unsigned char bytes[16];
+};
+
+// An IPv4 address in network order, written in dotted decimal
+struct ipv4_address {
+    unsigned char bytes[4];
+};
+
+// An IPv6 address in network order, written in the canonical form of RFC 5952
+struct ipv6_address {
+    unsigned char bytes[16];
+};
+
+// Binary data, written as a base64 string (RFC 4648, with padding)
+class bytes : public std::vector<utility::uint8_t> {
+public:
+    explicit bytes()
+    {
+    }
+
+    explicit bytes(std::size_t size, utility::uint8_t value = 0)
+        : std::vector<utility::uint8_t>(size, value)
+    {
+    }
+
+    template <class InputIterator>
+    bytes(InputIterator first, InputIterator last)
+        : std::vector<utility::uint8_t>(first, last)
+    {
+    }
+};
+
+#define AUTOJSONCXX_DEFINE_BYTES_COMPARISON(type)                           \
+    inline bool operator==(const type& a, const type& b)                    \
+    {                                                                       \
+        return std::memcmp(a.bytes, b.bytes, sizeof(a.bytes)) == 0;         \
+    }                                                                       \
+    inline bool operator!=(const type& a, const type& b)                    \
+    {                                                                       \
+        return !(a == b);                                                   \
+    }                                                                       \
+    inline bool operator<(const type& a, const type& b)                     \
+    {                                                                       \
+        return std::memcmp(a.bytes, b.bytes, sizeof(a.bytes)) < 0;          \
+    }
+
+AUTOJSONCXX_DEFINE_BYTES_COMPARISON(uuid)
+AUTOJSONCXX_DEFINE_BYTES_COMPARISON(ipv4_address)
+AUTOJSONCXX_DEFINE_BYTES_COMPARISON(ipv6_address)
+
+#undef AUTOJSONCXX_DEFINE_BYTES_COMPARISON
+
+namespace utility {
+
+    // The number of characters written by the formatting functions below, at most
+    const std::size_t uuid_length = 36;
+    const std::size_t max_ipv4_length = 15;
+    const std::size_t max_ipv6_length = 45;
+    const std::size_t max_date_time_length = 30;
+
+    inline std::size_t base64_length(std::size_t size)
+    {
+        return (size + 2) / 3 * 4;
+    }
+
+    namespace internal {
+        inline char hex_digit(unsigned value)
+        {
+            return "0123456789abcdef"[value];
+        }
+
+        // The value of a hexadecimal digit, or 16 for any other character, without branching on the input
+        inline unsigned hex_value(char c)
+        {
+            unsigned digit = static_cast<unsigned char>(c) - '0';
+            unsigned letter = (static_cast<unsigned char>(c) | 0x20) - 'a';
+            return digit < 10 ? digit : letter < 6 ? letter + 10 : 16;
+        }
+
+        // Reads a fixed number of decimal digits, or-ing into `invalid` anything above 9
+        inline unsigned fixed_decimal(const char* str, int count, unsigned& invalid)
+        {
+            unsigned value = 0;
+            for (int i = 0; i < count; ++i) {
+                unsigned digit = static_cast<unsigned char>(str[i]) - '0';
+                invalid |= digit > 9;
+                value = value * 10 + digit;
+            }
+            return value;
+        }
+
+        // Writes at least `width` decimal digits
+        inline char* write_decimal(char* p, unsigned value, int width)
+        {
+            char digits[10];
+            int count = 0;
+            do {
+                digits[count++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            while (count < width)
+                digits[count++] = '0';
+            while (count > 0)
+                *p++ = digits[--count];
+            return p;
+        }
+
+        // Days since 1970-01-01 of a date of the proleptic Gregorian calendar, and back
+        inline int64_t days_from_civil(int64_t year, unsigned month, unsigned day)
+        {
+            year -= month <= 2;
+            int64_t era = (year >= 0 ? year : year - 399) / 400;
+            unsigned year_of_era = static_cast<unsigned>(year - era * 400);
+            unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+            unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+            return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+        }
+
+        inline void civil_from_days(int64_t days, int64_t& year, unsigned& month, unsigned& day)
+        {
+            days += 719468;
+            int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+            unsigned day_of_era = static_cast<unsigned>(days - era * 146097);
+            unsigned year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+            unsigned day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+            unsigned shifted_month = (5 * day_of_year + 2) / 153;
+            day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+            month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+            year = static_cast<int64_t>(year_of_era) + era * 400 + (month <= 2);
+        }
+
+        // The value of each character in the base64 alphabet, and 64 for all the others
+        inline const unsigned char* base64_values()
+        {
+            static const unsigned char values[256] = {
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 64, 64, 63,
+                52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
+                64, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+                15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 64,
+                64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+                41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64
+            };
+            return values;
+        }
+
+#if AUTOJSONCXX_HAS_SSE2
+
+        // The bytes of `chunk` from `low` to `high`, as a mask
+        inline __m128i in_range_sse2(__m128i chunk, char low, char high)
+        {
+            return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(static_cast<char>(low - 1))),
+                                 _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(high + 1)), chunk));
+        }
+
+        // The values of 16 hexadecimal digits, each pair of them, high first, packed into a byte in a 16-bit lane.
+        // Characters that are not digits are added to `valid` as zero bits.
+        inline __m128i hex_pairs_sse2(const char* digits, int& valid)
+        {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+            __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+            __m128i digit = in_range_sse2(chunk, '0', '9');
+            __m128i letter = in_range_sse2(folded, 'a', 'f');
+            valid &= _mm_movemask_epi8(_mm_or_si128(digit, letter));
+
+            __m128i values = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(chunk, _mm_set1_epi8('0'))),
+                                          _mm_and_si128(letter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+            return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0xFF)), 4), _mm_srli_epi16(values, 8));
+        }
+
+        // 32 hexadecimal digits into 16 bytes, all checked at once
+        inline bool decode_hex_sse2(const char* digits, unsigned char* output)
+        {
+            int valid = 0xFFFF;
+            __m128i first = hex_pairs_sse2(digits, valid);
+            __m128i second = hex_pairs_sse2(digits + 16, valid);
+            if (valid != 0xFFFF)
+                return false;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(first, second));
+            return true;
+        }
+
+#endif
+
+        inline unsigned days_in_month(unsigned year, unsigned month)
+        {
+            static const unsigned char days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+            bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+            return days[month - 1] + (month == 2 && leap);
+        }
+    }
+
+    // The parsers below read the whole string and write the result only when it is valid.
+    // Fixed layouts are decoded at fixed offsets, with SSE2 where available, checking all the characters
+    // at once at the end.
+
+    inline bool parse_uuid(const char* str, std::size_t length, uuid& result)
+    {
+        if (length != uuid_length || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-')
+            return false;
+
+        uuid value;
+#if AUTOJSONCXX_HAS_SSE2
+        // The digits without the hyphens, decoded in two vectors
+        char digits[32];
+        std::memcpy(digits, str, 8);
+        std::memcpy(digits + 8, str + 9, 4);
+        std::memcpy(digits + 12, str + 14, 4);
+        std::memcpy(digits + 16, str + 19, 4);
+        std::memcpy(digits + 20, str + 24, 12);
+        if (!internal::decode_hex_sse2(digits, value.bytes))
+            return false;
+#else
+        static const unsigned char offsets[16] = { 0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34 };
+
+        unsigned invalid = 0;
+        for (int i = 0; i < 16; ++i) {
+            unsigned high = internal::hex_value(str[offsets[i]]), low = internal::hex_value(str[offsets[i] + 1]);
+            invalid |= high | low;
+            value.bytes[i] = static_cast<unsigned char>(high << 4 | low);
+        }
+        if (invalid >= 16)
+            return false;
+#endif
+        result = value;
+        return true;
+    }
+
+    // Dotted decimal without leading zeros, which some parsers read as octal
+    inline bool parse_ipv4(const char* str, std::size_t length, unsigned char* bytes)
+    {
+        const char *p = str, *end = str + length;
+        unsigned char value[4];
+
+        for (int i = 0; i < 4; ++i) {
+            if (i > 0) {
+                if (p == end || *p != '.')
+                    return false;
+                ++p;
+            }
+            const char* start = p;
+            unsigned number = 0;
+            while (p != end && p - start < 3 && static_cast<unsigned>(*p - '0') < 10)
+                number = number * 10 + (*p++ - '0');
+            if (p == start || number > 255 || (p - start > 1 && *start == '0'))
+                return false;
+            value[i] = static_cast<unsigned char>(number);
+        }
+        if (p != end)
+            return false;
+        std::memcpy(bytes, value, 4);
+        return true;
+    }
+
+    inline bool parse_ipv4(const char* str, std::size_t length, ipv4_address& result)
+    {
+        return parse_ipv4(str, length, result.bytes);
+    }
+
+    // Up to eight groups of hexadecimal digits, one run of which may be elided as "::",
+    // optionally ending with an embedded IPv4 address
+    inline bool parse_ipv6(const char* str, std::size_t length, ipv6_address& result)
+    {
+        const char *p = str, *end = str + length;
+        unsigned char bytes[16];
+        int count = 0;
+        int gap = -1;
+
+        if (end - p >= 2 && p[0] == ':' && p[1] == ':') {
+            gap = 0;
+            p += 2;
+        } else if (p != end && *p == ':') {
+            return false;
+        }
+
+        while (p != end) {
+            if (count == 16)
+                return false;
+            const char* group_end = static_cast<const char*>(std::memchr(p, ':', end - p));
+            if (!group_end)
+                group_end = end;
+
+            if (std::memchr(p, '.', group_end - p)) {
+                if (group_end != end || count > 12 || !parse_ipv4(p, end - p, bytes + count))
+                    return false;
+                count += 4;
+                break;
+            }
+
+            if (group_end == p || group_end - p > 4)
+                return false;
+            unsigned group = 0, invalid = 0;
+            for (; p != group_end; ++p) {
+                unsigned digit = internal::hex_value(*p);
+                invalid |= digit;
+                group = group << 4 | digit;
+            }
+            if (invalid >= 16)
+                return false;
+            bytes[count++] = static_cast<unsigned char>(group >> 8);
+            bytes[count++] = static_cast<unsigned char>(group);
+
+            if (p == end)
+                break;
+            ++p;
+            if (p == end)
+                return false;
+            if (*p == ':') {
+                if (gap >= 0)
+                    return false;
+                gap = count;
+                ++p;
+            }
+        }
+
+        if (gap < 0) {
+            if (count != 16)
+                return false;
+        } else {
+            // "::" stands for at least one group of zeros
+            if (count > 14)
+                return false;
+            int tail = count - gap;
+            std::memmove(bytes + 16 - tail, bytes + gap, tail);
+            std::memset(bytes + gap, 0, 16 - count);
+        }
+        std::memcpy(result.bytes, bytes, 16);
+        return true;
+    }
+
+    // RFC 3339, such as "1985-04-12T23:20:50.52Z" or "1996-12-19T16:39:57-08:00", as the seconds and nanoseconds
+    // since the epoch. Fractions beyond nanoseconds are truncated, and leap seconds are folded into the next second.
+    inline bool parse_date_time(const char* str, std::size_t length, int64_t& seconds, unsigned& nanoseconds)
+    {
+        if (length < 20)
+            return false;
+
+        unsigned invalid = 0;
+        unsigned year = internal::fixed_decimal(str, 4, invalid);
+        unsigned month = internal::fixed_decimal(str + 5, 2, invalid);
+        unsigned day = internal::fixed_decimal(str + 8, 2, invalid);
+        unsigned hour = internal::fixed_decimal(str + 11, 2, invalid);
+        unsigned minute = internal::fixed_decimal(str + 14, 2, invalid);
+        unsigned second = internal::fixed_decimal(str + 17, 2, invalid);
+
+        if (invalid || str[4] != '-' || str[7] != '-' || (str[10] != 'T' && str[10] != 't') || str[13] != ':'
+            || str[16] != ':')
+            return false;
+        if (month < 1 || month > 12 || day < 1 || day > internal::days_in_month(year, month) || hour > 23
+            || minute > 59 || second > 60)
+            return false;
+
+        const char *p = str + 19, *end = str + length;
+        unsigned fraction = 0;
+        if (*p == '.') {
+            const char* start = ++p;
+            unsigned scale = 100000000;
+            for (; p != end && static_cast<unsigned>(*p - '0') < 10; ++p) {
+                fraction += (*p - '0') * scale;
+                scale /= 10;
+            }
+            if (p == start)
+                return false;
+        }
+
+        int64_t offset = 0;
+        if (p != end && (*p == 'Z' || *p == 'z')) {
+            ++p;
+        } else if (end - p == 6 && (*p == '+' || *p == '-') && p[3] == ':') {
+            unsigned offset_hour = internal::fixed_decimal(p + 1, 2, invalid);
+            unsigned offset_minute = internal::fixed_decimal(p + 4, 2, invalid);
+            if (invalid || offset_hour > 23 || offset_minute > 59)
+                return false;
+            offset = (offset_hour * 60 + offset_minute) * 60;
+            if (*p == '-')
+                offset = -offset;
+            p += 6;
+        }
+        if (p != end)
+            return false;
+
+        seconds = internal::days_from_civil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset;
+        nanoseconds = fraction;
+        return true;
+    }
+
+    namespace internal {
+        // The vector paths below handle whole blocks, and leave the rest to the scalar loops. Characters are
+        // mapped to and from their values with comparisons, and the 6-bit fields are packed or split in 32-bit
+        // lanes, one group of four characters each.
+
+#if AUTOJSONCXX_HAS_SSE2
+
+        // Decodes blocks of 16 characters into 12 bytes, stopping before a block with a character outside
+        // the alphabet. Returns the number of characters decoded.
+        inline std::size_t decode_base64_sse2(const unsigned char* str, std::size_t length, unsigned char* output)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= length; i += 16, output += 12) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+                __m128i upper = in_range_sse2(chunk, 'A', 'Z');
+                __m128i lower = in_range_sse2(chunk, 'a', 'z');
+                __m128i digit = in_range_sse2(chunk, '0', '9');
+                __m128i plus = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('+'));
+                __m128i slash = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('/'));
+                __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)), slash);
+                if (_mm_movemask_epi8(valid) != 0xFFFF)
+                    break;
+
+                __m128i offset = _mm_or_si128(
+                    _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')), _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+                    _mm_or_si128(_mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                                              _mm_and_si128(plus, _mm_set1_epi8(62 - '+'))),
+                                 _mm_and_si128(slash, _mm_set1_epi8(63 - '/'))));
+                __m128i values = _mm_add_epi8(chunk, offset);
+                __m128i pairs = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0xFF)), 6),
+                                             _mm_srli_epi16(values, 8));
+                __m128i groups = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(pairs, _mm_set1_epi32(0xFFFF)), 12),
+                                              _mm_srli_epi32(pairs, 16));
+
+                unsigned lanes[4];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), groups);
+                for (int k = 0; k < 4; ++k) {
+                    output[3 * k] = static_cast<unsigned char>(lanes[k] >> 16);
+                    output[3 * k + 1] = static_cast<unsigned char>(lanes[k] >> 8);
+                    output[3 * k + 2] = static_cast<unsigned char>(lanes[k]);
+                }
+            }
+            return i;
+        }
+
+        // Encodes blocks of 12 bytes into 16 characters. Returns the number of bytes encoded.
+        inline std::size_t encode_base64_sse2(char* buffer, const unsigned char* data, std::size_t size)
+        {
+            const __m128i mask = _mm_set1_epi32(63);
+
+            std::size_t i = 0;
+            for (; i + 12 <= size; i += 12, buffer += 16) {
+                const unsigned char* d = data + i;
+                __m128i groups = _mm_set_epi32(d[9] << 16 | d[10] << 8 | d[11], d[6] << 16 | d[7] << 8 | d[8],
+                                               d[3] << 16 | d[4] << 8 | d[5], d[0] << 16 | d[1] << 8 | d[2]);
+                __m128i indices = _mm_or_si128(
+                    _mm_or_si128(_mm_srli_epi32(groups, 18), _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(groups, 12), mask), 8)),
+                    _mm_or_si128(_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(groups, 6), mask), 16),
+                                 _mm_slli_epi32(_mm_and_si128(groups, mask), 24)));
+
+                // 'A' for the first 26 values, then moved along at each boundary of the alphabet
+                __m128i offset = _mm_add_epi8(
+                    _mm_add_epi8(_mm_set1_epi8('A'), _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(25)), _mm_set1_epi8(6))),
+                    _mm_add_epi8(_mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(51)), _mm_set1_epi8(-75)),
+                                 _mm_add_epi8(_mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(61)), _mm_set1_epi8(-15)),
+                                              _mm_and_si128(_mm_cmpeq_epi8(indices, _mm_set1_epi8(63)), _mm_set1_epi8(3)))));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), _mm_add_epi8(indices, offset));
+            }
+            return i;
+        }
+
+#endif
+
+#if AUTOJSONCXX_HAS_AVX2_DISPATCH
+
+        __attribute__((target("avx2"))) inline __m256i in_range_avx2(__m256i chunk, char low, char high)
+        {
+            return _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8(static_cast<char>(low - 1))),
+                                    _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(high + 1)), chunk));
+        }
+
+        __attribute__((target("avx2"))) inline std::size_t decode_base64_avx2(const unsigned char* str, std::size_t length,
+                                                                               unsigned char* output)
+        {
+            std::size_t i = 0;
+            for (; i + 32 <= length; i += 32, output += 24) {
+                __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+                __m256i upper = in_range_avx2(chunk, 'A', 'Z');
+                __m256i lower = in_range_avx2(chunk, 'a', 'z');
+                __m256i digit = in_range_avx2(chunk, '0', '9');
+                __m256i plus = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('+'));
+                __m256i slash = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('/'));
+                __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, plus)), slash);
+                if (static_cast<unsigned>(_mm256_movemask_epi8(valid)) != 0xFFFFFFFFu)
+                    break;
+
+                __m256i offset = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                                    _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+                    _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+                                                    _mm256_and_si256(plus, _mm256_set1_epi8(62 - '+'))),
+                                    _mm256_and_si256(slash, _mm256_set1_epi8(63 - '/'))));
+                __m256i values = _mm256_add_epi8(chunk, offset);
+                __m256i pairs = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(values, _mm256_set1_epi16(0xFF)), 6),
+                                                _mm256_srli_epi16(values, 8));
+                __m256i groups = _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(pairs, _mm256_set1_epi32(0xFFFF)), 12),
+                                                 _mm256_srli_epi32(pairs, 16));
+
+                unsigned lanes[8];
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), groups);
+                for (int k = 0; k < 8; ++k) {
+                    output[3 * k] = static_cast<unsigned char>(lanes[k] >> 16);
+                    output[3 * k + 1] = static_cast<unsigned char>(lanes[k] >> 8);
+                    output[3 * k + 2] = static_cast<unsigned char>(lanes[k]);
+                }
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2"))) inline std::size_t encode_base64_avx2(char* buffer, const unsigned char* data,
+                                                                               std::size_t size)
+        {
+            const __m256i mask = _mm256_set1_epi32(63);
+
+            std::size_t i = 0;
+            for (; i + 24 <= size; i += 24, buffer += 32) {
+                const unsigned char* d = data + i;
+                __m256i groups = _mm256_set_epi32(
+                    d[21] << 16 | d[22] << 8 | d[23], d[18] << 16 | d[19] << 8 | d[20], d[15] << 16 | d[16] << 8 | d[17],
+                    d[12] << 16 | d[13] << 8 | d[14], d[9] << 16 | d[10] << 8 | d[11], d[6] << 16 | d[7] << 8 | d[8],
+                    d[3] << 16 | d[4] << 8 | d[5], d[0] << 16 | d[1] << 8 | d[2]);
+                __m256i indices = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_srli_epi32(groups, 18),
+                                    _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(groups, 12), mask), 8)),
+                    _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(groups, 6), mask), 16),
+                                    _mm256_slli_epi32(_mm256_and_si256(groups, mask), 24)));
+
+                __m256i offset = _mm256_add_epi8(
+                    _mm256_add_epi8(_mm256_set1_epi8('A'),
+                                    _mm256_and_si256(_mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)), _mm256_set1_epi8(6))),
+                    _mm256_add_epi8(
+                        _mm256_and_si256(_mm256_cmpgt_epi8(indices, _mm256_set1_epi8(51)), _mm256_set1_epi8(-75)),
+                        _mm256_add_epi8(_mm256_and_si256(_mm256_cmpgt_epi8(indices, _mm256_set1_epi8(61)), _mm256_set1_epi8(-15)),
+                                        _mm256_and_si256(_mm256_cmpeq_epi8(indices, _mm256_set1_epi8(63)), _mm256_set1_epi8(3)))));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(buffer), _mm256_add_epi8(indices, offset));
+            }
+            return i;
+        }
+
+#endif
+
+        // The widest vector path available at runtime, for as many whole blocks as there are
+        inline std::size_t decode_base64_blocks(const unsigned char* str, std::size_t length, unsigned char* output)
+        {
+            std::size_t i = 0;
+#if AUTOJSONCXX_HAS_AVX2_DISPATCH
+            if (length >= 32 && cpu_has_avx2())
+                i = decode_base64_avx2(str, length, output);
+#endif
+#if AUTOJSONCXX_HAS_SSE2
+            i += decode_base64_sse2(str + i, length - i, output + i / 4 * 3);
+#endif
+            (void)str;
+            (void)length;
+            (void)output;
+            return i;
+        }
+
+        inline std::size_t encode_base64_blocks(char* buffer, const unsigned char* data, std::size_t size)
+        {
+            std::size_t i = 0;
+#if AUTOJSONCXX_HAS_AVX2_DISPATCH
+            if (size >= 24 && cpu_has_avx2())
+                i = encode_base64_avx2(buffer, data, size);
+#endif
+#if AUTOJSONCXX_HAS_SSE2
+            i += encode_base64_sse2(buffer + i / 3 * 4, data + i, size - i);
+#endif
+            (void)buffer;
+            (void)data;
+            (void)size;
+            return i;
+        }
+    }
+
+    // Padded base64 into `output`, which has room for `length / 4 * 3` bytes. Whole blocks go through the vector
+    // paths; the remaining groups of four characters are decoded through a table, and checked all at once at the end.
+    inline bool decode_base64(const char* str, std::size_t length, unsigned char* output, std::size_t& output_length)
+    {
+        if (length % 4 != 0)
+            return false;
+
+        std::size_t padding = 0;
+        if (length > 0 && str[length - 1] == '=')
+            padding = str[length - 2] == '=' ? 2 : 1;
+
+        const unsigned char* values = internal::base64_values();
+        const unsigned char* s = reinterpret_cast<const unsigned char*>(str);
+        const std::size_t whole = padding ? length - 4 : length;
+        const std::size_t vectorized = internal::decode_base64_blocks(s, whole, output);
+        unsigned char* p = output + vectorized / 4 * 3;
+        unsigned invalid = 0;
+
+        for (std::size_t i = vectorized; i < whole; i += 4, p += 3) {
+            unsigned a = values[s[i]], b = values[s[i + 1]], c = values[s[i + 2]], d = values[s[i + 3]];
+            invalid |= a | b | c | d;
+            unsigned group = a << 18 | b << 12 | c << 6 | d;
+            p[0] = static_cast<unsigned char>(group >> 16);
+            p[1] = static_cast<unsigned char>(group >> 8);
+            p[2] = static_cast<unsigned char>(group);
+        }
+        if (padding) {
+            unsigned a = values[s[whole]], b = values[s[whole + 1]], c = padding == 1 ? values[s[whole + 2]] : 0;
+            invalid |= a | b | c;
+            unsigned group = a << 18 | b << 12 | c << 6;
+            *p++ = static_cast<unsigned char>(group >> 16);
+            if (padding == 1)
+                *p++ = static_cast<unsigned char>(group >> 8);
+        }
+        if (invalid & 64)
+            return false;
+        output_length = static_cast<std::size_t>(p - output);
+        return true;
+    }
+
+    // The formatting functions below return the end of the output
+
+    // Into `base64_length(size)` characters, with padding: whole blocks through the vector paths,
+    // then three bytes at a time
+    inline char* encode_base64(char* buffer, const unsigned char* data, std::size_t size)
+    {
+        static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        std::size_t i = internal::encode_base64_blocks(buffer, data, size);
+        char* p = buffer + i / 3 * 4;
+        for (; i + 3 <= size; i += 3, p += 4) {
+            unsigned group = static_cast<unsigned>(data[i]) << 16 | static_cast<unsigned>(data[i + 1]) << 8 | data[i + 2];
+            p[0] = alphabet[group >> 18];
+            p[1] = alphabet[(group >> 12) & 63];
+            p[2] = alphabet[(group >> 6) & 63];
+            p[3] = alphabet[group & 63];
+        }
+        if (i < size) {
+            bool two = i + 2 == size;
+            unsigned group = static_cast<unsigned>(data[i]) << 16 | (two ? static_cast<unsigned>(data[i + 1]) << 8 : 0);
+            p[0] = alphabet[group >> 18];
+            p[1] = alphabet[(group >> 12) & 63];
+            p[2] = two ? alphabet[(group >> 6) & 63] : '=';
+            p[3] = '=';
+            p += 4;
+        }
+        return p;
+    }
+
+    inline char* format_uuid(char* buffer, const uuid& value)
+    {
+        char* p = buffer;
+        for (int i = 0; i < 16; ++i) {
+            if (i == 4 || i == 6 || i == 8 || i == 10)
+                *p++ = '-';
+            *p++ = internal::hex_digit(value.bytes[i] >> 4);
+            *p++ = internal::hex_digit(value.bytes[i] & 15);
+        }
+        return p;
+    }
+
+    inline char* format_ipv4(char* buffer, const unsigned char* bytes)
+    {
+        char* p = buffer;
+        for (int i = 0; i < 4; ++i) {
+            if (i > 0)
+                *p++ = '.';
+            p = internal::write_decimal(p, bytes[i], 1);
+        }
+        return p;
+    }
+
+    inline char* format_ipv4(char* buffer, const ipv4_address& value)
+    {
+        return format_ipv4(buffer, value.bytes);
+    }
+
+    // Lowercase, without leading zeros, eliding the first longest run of two or more zero groups,
+    // and IPv4-mapped addresses as "::ffff:a.b.c.d"
+    inline char* format_ipv6(char* buffer, const ipv6_address& value)
+    {
+        unsigned groups[8];
+        for (int i = 0; i < 8; ++i)
+            groups[i] = static_cast<unsigned>(value.bytes[2 * i]) << 8 | value.bytes[2 * i + 1];
+
+        int gap = -1, gap_length = 1;
+        for (int i = 0; i < 8;) {
+            if (groups[i] != 0) {
+                ++i;
+                continue;
+            }
+            int j = i;
+            while (j < 8 && groups[j] == 0)
+                ++j;
+            if (j - i > gap_length) {
+                gap = i;
+                gap_length = j - i;
+            }
+            i = j;
+        }
+
+        char* p = buffer;
+        if (gap == 0 && gap_length == 5 && groups[5] == 0xffff) {
+            std::memcpy(p, "::ffff:", 7);
+            return format_ipv4(p + 7, value.bytes + 12);
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            if (i == gap) {
+                *p++ = ':';
+                *p++ = ':';
+                i += gap_length - 1;
+                continue;
+            }
+            if (i > 0 && i != gap + gap_length)
+                *p++ = ':';
+            int shift = 12;
+            while (shift > 0 && (groups[i] >> shift) == 0)
+                shift -= 4;
+            for (; shift >= 0; shift -= 4)
+                *p++ = internal::hex_digit((groups[i] >> shift) & 15);
+        }
+        return p;
+    }
+
+    // In UTC, as "YYYY-MM-DDTHH:MM:SS[.fraction]Z" without trailing zeros in the fraction.
+    // Returns null for years outside 0000 to 9999, which RFC 3339 cannot express.
+    inline char* format_date_time(char* buffer, int64_t seconds, unsigned nanoseconds)
+    {
+        int64_t days = (seconds >= 0 ? seconds : seconds - 86399) / 86400;
+        unsigned time = static_cast<unsigned>(seconds - days * 86400);
+        int64_t year;
+        unsigned month, day;
+        internal::civil_from_days(days, year, month, day);
+        if (year < 0 || year > 9999)
+            return 0;
+
+        char* p = internal::write_decimal(buffer, static_cast<unsigned>(year), 4);
+        *p++ = '-';
+        p = internal::write_decimal(p, month, 2);
+        *p++ = '-';
+        p = internal::write_decimal(p, day, 2);
+        *p++ = 'T';
+        p = internal::write_decimal(p, time / 3600, 2);
+        *p++ = ':';
+        p = internal::write_decimal(p, time / 60 % 60, 2);
+        *p++ = ':';
+        p = internal::write_decimal(p, time % 60, 2);
+        if (nanoseconds != 0) {
+            int digits = 9;
+            while (nanoseconds % 10 == 0) {
+                nanoseconds /= 10;
+                --digits;
+            }
+            *p++ = '.';
+            p = internal::write_decimal(p, nanoseconds, digits);
+        }
+        *p++ = 'Z';
+        return p;
+    }
+}
+
+// Parses a compact type directly from the string event; `Derived` provides `parse` and `type_name`,
+// which is also the name of the format in errors
+template <class T, class Derived>
+class FormattedSAXEventHandler : public BaseSAXEventHandler<Derived> {
+private:
+    T* m_value;
+
+    error::RejectedText m_rejected_value;
+
+public:
+    explicit FormattedSAXEventHandler(T* v)
+        : m_value(v)
+    {
+    }
+
+    bool String(const char* str, SizeType length, bool)
+    {
+        if (Derived::parse(str, length, *m_value))
+            return true;
+        this->the_error.template set<error::FormatMismatchError>(Derived::type_name(),
+                                                                 m_rejected_value.keep(str, length));
+        return false;
+    }
+};
+
+namespace internal {
+    // Writes the text formatted at `buffer + 1` up to `end`, quoting it in place so that writers
+    // taking string tokens get it verbatim; formatted text never needs escaping
+    template <class Writer>
+    void write_formatted(Writer& w, char* buffer, char* end)
+    {
+        buffer[0] = '"';
+        *end = '"';
+        SizeType length = static_cast<SizeType>(end - buffer - 1);
+        StringWriter<Writer>()(w, buffer + 1, length, buffer, length + 2);
+    }
+}
+
+template <>
+class SAXEventHandler<uuid> : public FormattedSAXEventHandler<uuid, SAXEventHandler<uuid> > {
+public:
+    explicit SAXEventHandler(uuid* v)
+        : FormattedSAXEventHandler<uuid, SAXEventHandler<uuid> >(v)
+    {
+    }
+
+    static bool parse(const char* str, SizeType length, uuid& value)
+    {
+        return utility::parse_uuid(str, length, value);
+    }
+
+    static const char* type_name()
+    {
+        return "uuid";
+    }
+};
+
+template <>
+class SAXEventHandler<ipv4_address> : public FormattedSAXEventHandler<ipv4_address, SAXEventHandler<ipv4_address> > {
+public:
+    explicit SAXEventHandler(ipv4_address* v)
+        : FormattedSAXEventHandler<ipv4_address, SAXEventHandler<ipv4_address> >(v)
+    {
+    }
+
+    static bool parse(const char* str, SizeType length, ipv4_address& value)
+    {
+        return utility::parse_ipv4(str, length, value);
+    }
+
+    static const char* type_name()
+    {
+        return "ipv4";
+    }
+};
+
+template <>
+class SAXEventHandler<ipv6_address> : public FormattedSAXEventHandler<ipv6_address, SAXEventHandler<ipv6_address> > {
+public:
+    explicit SAXEventHandler(ipv6_address* v)
+        : FormattedSAXEventHandler<ipv6_address, SAXEventHandler<ipv6_address> >(v)
+    {
+    }
+
+    static bool parse(const char* str, SizeType length, ipv6_address& value)
+    {
+        return utility::parse_ipv6(str, length, value);
+    }
+
+    static const char* type_name()
+    {
+        return "ipv6";
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, uuid> {
+    void operator()(Writer& w, const uuid& value) const
+    {
+        char buffer[utility::uuid_length + 2];
+        internal::write_formatted(w, buffer, utility::format_uuid(buffer + 1, value));
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, ipv4_address> {
+    void operator()(Writer& w, const ipv4_address& value) const
+    {
+        char buffer[utility::max_ipv4_length + 2];
+        internal::write_formatted(w, buffer, utility::format_ipv4(buffer + 1, value));
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, ipv6_address> {
+    void operator()(Writer& w, const ipv6_address& value) const
+    {
+        char buffer[utility::max_ipv6_length + 2];
+        internal::write_formatted(w, buffer, utility::format_ipv6(buffer + 1, value));
+    }
+};
+
+// Decodes base64 straight into the bytes, without a copy of the text
+template <>
+class SAXEventHandler<bytes> : public FormattedSAXEventHandler<bytes, SAXEventHandler<bytes> > {
+public:
+    explicit SAXEventHandler(bytes* v)
+        : FormattedSAXEventHandler<bytes, SAXEventHandler<bytes> >(v)
+    {
+    }
+
+    static bool parse(const char* str, SizeType length, bytes& value)
+    {
+        value.resize(length / 4 * 3);
+        std::size_t size = 0;
+        if (!utility::decode_base64(str, length, value.empty() ? 0 : &value[0], size)) {
+            value.clear();
+            return false;
+        }
+        value.resize(size);
+        return true;
+    }
+
+    static const char* type_name()
+    {
+        return "base64";
+    }
+};
+
+// Writers take a string whole, so the text is encoded once into a buffer of its exact size,
+// which is on the stack unless the data is large
+template <class Writer>
+struct Serializer<Writer, bytes> {
+    void operator()(Writer& w, const bytes& value) const
+    {
+        char small_buffer[256];
+        std::vector<char> large_buffer;
+        char* buffer = small_buffer;
+
+        std::size_t length = utility::base64_length(value.size()) + 2;
+        if (length > sizeof(small_buffer)) {
+            large_buffer.resize(length);
+            buffer = &large_buffer[0];
+        }
+        internal::write_formatted(
+            w, buffer, utility::encode_base64(buffer + 1, value.empty() ? 0 : &value[0], value.size()));
+    }
+};
+
+#if AUTOJSONCXX_HAS_MODERN_TYPES
+
+// Time points of the system clock, whose epoch is the Unix epoch, as RFC 3339 date-times
+template <class Duration>
+class SAXEventHandler<std::chrono::time_point<std::chrono::system_clock, Duration> >
+    : public FormattedSAXEventHandler<std::chrono::time_point<std::chrono::system_clock, Duration>,
+                                      SAXEventHandler<std::chrono::time_point<std::chrono::system_clock, Duration> > > {
+private:
+    typedef std::chrono::time_point<std::chrono::system_clock, Duration> time_point;
+
+public:
+    explicit SAXEventHandler(time_point* v)
+        : FormattedSAXEventHandler<time_point, SAXEventHandler>(v)
+    {
+    }
+
+    static bool parse(const char* str, SizeType length, time_point& value)
+    {
+        utility::int64_t seconds;
+        unsigned nanoseconds;
+        if (!utility::parse_date_time(str, length, seconds, nanoseconds))
+            return false;
+
+        // Dates the duration cannot count to are rejected rather than wrapped around
+        typedef std::chrono::duration<long double> wide_seconds;
+        if (wide_seconds(seconds) > std::chrono::duration_cast<wide_seconds>(Duration::max())
+            || wide_seconds(seconds) < std::chrono::duration_cast<wide_seconds>(Duration::min()))
+            return false;
+
+        value = time_point(std::chrono::duration_cast<Duration>(std::chrono::seconds(seconds))
+                           + std::chrono::duration_cast<Duration>(std::chrono::nanoseconds(nanoseconds)));
+        return true;
+    }
+
+    static const char* type_name()
+    {
+        return "date-time";
+    }
+};
+
+template <class Writer, class Duration>
+struct Serializer<Writer, std::chrono::time_point<std::chrono::system_clock, Duration> > {
+    void operator()(Writer& w, const std::chrono::time_point<std::chrono::system_clock, Duration>& value) const
+    {
+        Duration since_epoch = value.time_since_epoch();
+        std::chrono::seconds seconds = std::chrono::duration_cast<std::chrono::seconds>(since_epoch);
+        if (seconds > since_epoch)
+            seconds -= std::chrono::seconds(1);
+        std::chrono::nanoseconds fraction = std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch - seconds);
+
+        char buffer[utility::max_date_time_length + 2];
+        char* end = utility::format_date_time(buffer + 1, seconds.count(), static_cast<unsigned>(fraction.count()));
+
+        // Only years outside 0000 to 9999, which RFC 3339 cannot express, get here. The handler rejects
+        // the null, so such a time point does not read back; the definition file syntax says so
+        if (!end) {
+            w.Null();
+            return;
+        }
+        internal::write_formatted(w, buffer, end);
+    }
+};
+
+#endif
+}
+
+#endif
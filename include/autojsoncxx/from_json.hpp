@@ -48,18 +48,51 @@ inline bool from_json(Reader& r, InputStream& is, ValueType& value, ParsingResul
     return !result.has_error();
 }
 
+// Policies selecting how the `from_json` family of functions runs the reader
+struct DefaultReaderPolicy {
+    template <class InputStream, class Handler>
+    static rapidjson::ParseResult parse(InputStream& is, Handler& handler)
+    {
+        rapidjson::Reader reader;
+        return reader.Parse(is, handler);
+    }
+};
+
+template <class InputStream, class ValueType, class ReaderPolicy>
+inline bool from_json(InputStream& is, ValueType& value, ParsingResult& result, ReaderPolicy)
+{
+    typedef SAXEventHandler<ValueType> handler_type;
+
+    utility::scoped_ptr<handler_type> handler(new handler_type(&value));
+
+    result.set_result(ReaderPolicy::parse(is, *handler));
+    handler->ReapError(result.error_stack());
+    return !result.has_error();
+}
+
 template <class InputStream, class ValueType>
 inline bool from_json(InputStream& is, ValueType& value, ParsingResult& result)
 {
-    rapidjson::Reader reader;
-    return from_json(reader, is, value, result);
+    return from_json(is, value, result, DefaultReaderPolicy());
+}
+
+template <class ValueType, class ReaderPolicy>
+inline bool from_json_string(const char* json, ValueType& value, ParsingResult& result, ReaderPolicy policy)
+{
+    rapidjson::StringStream ss(json);
+    return from_json(ss, value, result, policy);
 }
 
 template <class ValueType>
 inline bool from_json_string(const char* json, ValueType& value, ParsingResult& result)
 {
-    rapidjson::StringStream ss(json);
-    return from_json(ss, value, result);
+    return from_json_string(json, value, result, DefaultReaderPolicy());
+}
+
+template <class ValueType, class ReaderPolicy>
+inline bool from_json_string(const std::string& json, ValueType& value, ParsingResult& result, ReaderPolicy policy)
+{
+    return from_json_string(json.c_str(), value, result, policy);
 }
 
 template <class ValueType>
@@ -68,12 +101,18 @@ inline bool from_json_string(const std::string& json, ValueType& value, ParsingR
     return from_json_string(json.c_str(), value, result);
 }
 
-template <class ValueType>
-inline bool from_json_file(std::FILE* file, ValueType& value, ParsingResult& result)
+template <class ValueType, class ReaderPolicy>
+inline bool from_json_file(std::FILE* file, ValueType& value, ParsingResult& result, ReaderPolicy policy)
 {
     char buffer[utility::default_buffer_size];
     rapidjson::FileReadStream fs(file, buffer, sizeof(buffer));
-    return from_json(fs, value, result);
+    return from_json(fs, value, result, policy);
+}
+
+template <class ValueType>
+inline bool from_json_file(std::FILE* file, ValueType& value, ParsingResult& result)
+{
+    return from_json_file(file, value, result, DefaultReaderPolicy());
 }
 
 template <class ValueType>
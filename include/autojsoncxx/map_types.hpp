@@ -26,9 +26,12 @@
 #include <autojsoncxx/utility.hpp>
 #include <autojsoncxx/base.hpp>
 #include <autojsoncxx/error.hpp>
+#include <autojsoncxx/to_json.hpp>
 
 #include <map>
 #include <stack>
+#include <vector>
+#include <algorithm>
 #include <cassert>
 #include <string>
 
@@ -45,7 +48,7 @@ private:
     ElementType value;
 
     SAXEventHandler<ElementType> internal_handler;
-    utility::scoped_ptr<error::ErrorBase> the_error;
+    error::ErrorHolder the_error;
     utility::stack<signed char, 32> state;
     // A stack of StartArray() and StartObject() event
     // must be recorded, so we know when the current
@@ -56,7 +59,7 @@ private:
     {
         if (state.size() == 1 && state.top() == internal::OBJECT) {
             if (!static_cast<Derived*>(this)->Emplace(key, AUTOJSONCXX_MOVE_IF_NOEXCEPT(value))) {
-                the_error.reset(new error::DuplicateKeyError(AUTOJSONCXX_MOVE(key)));
+                the_error.set<error::DuplicateKeyError>(error::ErrorText(key.data(), key.size()));
                 return false;
             }
 
@@ -69,7 +72,7 @@ private:
     bool check_depth(const char* type)
     {
         if (state.empty()) {
-            the_error.reset(new error::TypeMismatchError("object", type));
+            the_error.set<error::TypeMismatchError>("object", type);
             return false;
         }
         return true;
@@ -86,7 +89,7 @@ private:
 
     void set_member_error()
     {
-        this->the_error.reset(new error::ObjectMemberError(key));
+        the_error.set<error::ObjectMemberError>(error::ErrorText(key.data(), key.size()));
     }
 
 public:
@@ -188,7 +191,7 @@ public:
         if (this->the_error.empty())
             return false;
 
-        errs.push(this->the_error.release());
+        the_error.move_to(errs);
         internal_handler.ReapError(errs);
         return true;
     }
@@ -205,7 +208,7 @@ template <class Writer, class MapType, class ElementType, class ConstIteratorTyp
 struct MapSerializer {
     void operator()(Writer& w, const MapType& map) const
     {
-        w.StartObject();
+        ContainerStarter<Writer>::object(w, static_cast<SizeType>(map.size()));
 
         for (ConstIteratorType it = map.begin(), end = map.end(); it != end; ++it) {
             w.Key(it->first.data(), static_cast<SizeType>(it->first.size()), true);
@@ -216,6 +219,103 @@ struct MapSerializer {
     }
 };
 
+template <class ConstIteratorType>
+struct MapIteratorKeyLess {
+    bool operator()(ConstIteratorType a, ConstIteratorType b) const
+    {
+        return a->first < b->first;
+    }
+};
+
+namespace internal {
+    // Writes the compact JSON text of a value, with nested unordered maps in canonical order too
+    class CanonicalTextWriter : public rapidjson::Writer<StringOutputStream> {
+    public:
+        explicit CanonicalTextWriter(StringOutputStream& os)
+            : rapidjson::Writer<StringOutputStream>(os)
+        {
+        }
+    };
+}
+
+namespace utility {
+    namespace traits {
+        template <>
+        struct is_canonical_writer<autojsoncxx::internal::CanonicalTextWriter> : public true_type {
+        };
+    }
+}
+
+namespace internal {
+    template <class ConstIteratorType>
+    struct TextIteratorLess {
+        bool operator()(const std::pair<std::string, ConstIteratorType>& a,
+                        const std::pair<std::string, ConstIteratorType>& b) const
+        {
+            return a.first < b.first;
+        }
+    };
+
+    // Orders members with equal keys, which only multimaps have, by the JSON text of their values
+    template <class ElementType, class ConstIteratorType>
+    void sort_equal_keys_by_value(std::vector<ConstIteratorType>& sorted)
+    {
+        typedef std::pair<std::string, ConstIteratorType> text_type;
+        std::vector<text_type> texts;
+
+        for (std::size_t first = 0, last; first < sorted.size(); first = last) {
+            for (last = first + 1; last < sorted.size() && sorted[last]->first == sorted[first]->first; ++last) {
+            }
+            if (last - first < 2)
+                continue;
+
+            texts.resize(last - first);
+            for (std::size_t i = first; i < last; ++i) {
+                text_type& text = texts[i - first];
+                text.first.clear();
+                text.second = sorted[i];
+                StringOutputStream os(text.first);
+                CanonicalTextWriter w(os);
+                Serializer<CanonicalTextWriter, ElementType>()(w, sorted[i]->second);
+            }
+            std::stable_sort(texts.begin(), texts.end(), TextIteratorLess<ConstIteratorType>());
+            for (std::size_t i = first; i < last; ++i)
+                sorted[i] = texts[i - first].second;
+        }
+    }
+}
+
+// For unordered maps, canonical writers get the members sorted by key, and then by value for multimaps.
+// Unlike the other serializers, this allocates: a vector of iterators to sort, and the text of
+// the values that share a key.
+template <class Writer, class MapType, class ElementType, class ConstIteratorType,
+          bool canonical = utility::traits::is_canonical_writer<Writer>::value>
+struct UnorderedMapSerializer : public MapSerializer<Writer, MapType, ElementType, ConstIteratorType> {
+};
+
+template <class Writer, class MapType, class ElementType, class ConstIteratorType>
+struct UnorderedMapSerializer<Writer, MapType, ElementType, ConstIteratorType, true> {
+    void operator()(Writer& w, const MapType& map) const
+    {
+        std::vector<ConstIteratorType> sorted;
+        sorted.reserve(map.size());
+        for (ConstIteratorType it = map.begin(), end = map.end(); it != end; ++it)
+            sorted.push_back(it);
+        std::stable_sort(sorted.begin(), sorted.end(), MapIteratorKeyLess<ConstIteratorType>());
+        internal::sort_equal_keys_by_value<ElementType>(sorted);
+
+        ContainerStarter<Writer>::object(w, static_cast<SizeType>(map.size()));
+
+        typedef typename std::vector<ConstIteratorType>::const_iterator iterator;
+        for (iterator it = sorted.begin(), end = sorted.end(); it != end; ++it) {
+            w.Key((*it)->first.data(), static_cast<SizeType>((*it)->first.size()), true);
+            Serializer<Writer, ElementType>()(w, (*it)->second);
+        }
+
+        w.EndObject(static_cast<SizeType>(map.size()));
+    }
+};
+
 template <class ElementType, class Compare, class Allocator>
 class SAXEventHandler<std::map<std::string, ElementType, Compare, Allocator> >
     : public MapBaseSAXEventHandler<ElementType,
@@ -324,7 +424,7 @@ public:
 
 template <class Writer, class ElementType, class Hash, class Equal, class Allocator>
 struct Serializer<Writer, std::unordered_map<std::string, ElementType, Hash, Equal, Allocator> >
-    : public MapSerializer<Writer, std::unordered_map<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename std::unordered_map<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
+    : public UnorderedMapSerializer<Writer, std::unordered_map<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename std::unordered_map<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
 };
 
 template <class ElementType, class Hash, class Equal, class Allocator>
@@ -359,7 +459,7 @@ public:
 
 template <class Writer, class ElementType, class Hash, class Equal, class Allocator>
 struct Serializer<Writer, std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator> >
-    : public MapSerializer<Writer, std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
+    : public UnorderedMapSerializer<Writer, std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>, ElementType, typename std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>::const_iterator> {
 };
 
 #endif
@@ -0,0 +1,628 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef AUTOJSONCXX_MSGPACK_HPP_29A4C106C1B1
+#define AUTOJSONCXX_MSGPACK_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/to_json.hpp>
+
+#include <rapidjson/error/error.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace autojsoncxx {
+
+namespace msgpack {
+    enum {
+        kNil = 0xc0,
+        kFalse = 0xc2,
+        kTrue = 0xc3,
+        kBin8 = 0xc4,
+        kBin16 = 0xc5,
+        kBin32 = 0xc6,
+        kFloat32 = 0xca,
+        kFloat64 = 0xcb,
+        kUint8 = 0xcc,
+        kUint16 = 0xcd,
+        kUint32 = 0xce,
+        kUint64 = 0xcf,
+        kInt8 = 0xd0,
+        kInt16 = 0xd1,
+        kInt32 = 0xd2,
+        kInt64 = 0xd3,
+        kStr8 = 0xd9,
+        kStr16 = 0xda,
+        kStr32 = 0xdb,
+        kArray16 = 0xdc,
+        kArray32 = 0xdd,
+        kMap16 = 0xde,
+        kMap32 = 0xdf
+    };
+}
+
+// A writer producing MessagePack instead of JSON text, usable with every `Serializer`.
+// The Writer concept only reveals the size of a container when it ends, so containers are
+// written into an internal buffer with a placeholder for their header; when the root value
+// is complete, the buffer is copied to the stream in one pass, with the smallest headers.
+template <class OutputStream>
+class MsgPackWriter {
+private:
+    struct Container {
+        std::size_t offset;
+        utility::uint64_t count;
+        bool is_map;
+    };
+
+    static const std::size_t placeholder_size = 5;
+
+    OutputStream* m_os;
+    std::string m_buffer;
+    std::vector<Container> m_containers;
+    std::vector<std::size_t> m_open;
+
+    MsgPackWriter(const MsgPackWriter&);
+    MsgPackWriter& operator=(const MsgPackWriter&);
+
+    void put(unsigned char c)
+    {
+        m_buffer.push_back(static_cast<char>(c));
+    }
+
+    void put_big_endian(utility::uint64_t value, int bytes)
+    {
+        for (int i = bytes - 1; i >= 0; --i)
+            put(static_cast<unsigned char>(value >> (8 * i)));
+    }
+
+    void start_value()
+    {
+        if (!m_open.empty() && !m_containers[m_open.back()].is_map)
+            ++m_containers[m_open.back()].count;
+    }
+
+    bool end_value()
+    {
+        if (m_open.empty())
+            flush_root();
+        return true;
+    }
+
+    void put_unsigned(utility::uint64_t value)
+    {
+        if (value < 0x80) {
+            put(static_cast<unsigned char>(value));
+        } else if (value <= 0xFF) {
+            put(msgpack::kUint8);
+            put_big_endian(value, 1);
+        } else if (value <= 0xFFFF) {
+            put(msgpack::kUint16);
+            put_big_endian(value, 2);
+        } else if (value <= 0xFFFFFFFFu) {
+            put(msgpack::kUint32);
+            put_big_endian(value, 4);
+        } else {
+            put(msgpack::kUint64);
+            put_big_endian(value, 8);
+        }
+    }
+
+    void put_signed(utility::int64_t value)
+    {
+        if (value >= 0) {
+            put_unsigned(static_cast<utility::uint64_t>(value));
+        } else if (value >= -32) {
+            put(static_cast<unsigned char>(value));
+        } else if (value >= -128) {
+            put(msgpack::kInt8);
+            put_big_endian(static_cast<utility::uint64_t>(value), 1);
+        } else if (value >= -32768) {
+            put(msgpack::kInt16);
+            put_big_endian(static_cast<utility::uint64_t>(value), 2);
+        } else if (value >= -2147483647 - 1) {
+            put(msgpack::kInt32);
+            put_big_endian(static_cast<utility::uint64_t>(value), 4);
+        } else {
+            put(msgpack::kInt64);
+            put_big_endian(static_cast<utility::uint64_t>(value), 8);
+        }
+    }
+
+    void put_string(const char* str, SizeType length)
+    {
+        if (length < 32) {
+            put(static_cast<unsigned char>(0xa0 | length));
+        } else if (length <= 0xFF) {
+            put(msgpack::kStr8);
+            put_big_endian(length, 1);
+        } else if (length <= 0xFFFF) {
+            put(msgpack::kStr16);
+            put_big_endian(length, 2);
+        } else {
+            put(msgpack::kStr32);
+            put_big_endian(length, 4);
+        }
+        m_buffer.append(str, length);
+    }
+
+    // Write the smallest header for a container of `count` elements (pairs for maps)
+    template <class Stream>
+    static void put_header(Stream& os, const Container& c)
+    {
+        char header[placeholder_size];
+        std::size_t length;
+        if (c.count < 16) {
+            header[0] = static_cast<char>((c.is_map ? 0x80 : 0x90) | c.count);
+            length = 1;
+        } else if (c.count <= 0xFFFF) {
+            header[0] = static_cast<char>(c.is_map ? msgpack::kMap16 : msgpack::kArray16);
+            header[1] = static_cast<char>(c.count >> 8);
+            header[2] = static_cast<char>(c.count);
+            length = 3;
+        } else {
+            header[0] = static_cast<char>(c.is_map ? msgpack::kMap32 : msgpack::kArray32);
+            for (int i = 0; i < 4; ++i)
+                header[1 + i] = static_cast<char>(c.count >> (24 - 8 * i));
+            length = 5;
+        }
+        put_range(os, header, length);
+    }
+
+    void flush_root()
+    {
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < m_containers.size(); ++i) {
+            put_range(*m_os, m_buffer.data() + pos, m_containers[i].offset - pos);
+            put_header(*m_os, m_containers[i]);
+            pos = m_containers[i].offset + placeholder_size;
+        }
+        put_range(*m_os, m_buffer.data() + pos, m_buffer.size() - pos);
+        m_buffer.clear();
+        m_containers.clear();
+    }
+
+    bool start_container(bool is_map)
+    {
+        start_value();
+        Container c;
+        c.offset = m_buffer.size();
+        c.count = 0;
+        c.is_map = is_map;
+        m_open.push_back(m_containers.size());
+        m_containers.push_back(c);
+        m_buffer.append(placeholder_size, '\0');
+        return true;
+    }
+
+    bool end_container()
+    {
+        assert(!m_open.empty());
+        m_open.pop_back();
+        return end_value();
+    }
+
+public:
+    typedef char Ch;
+
+    explicit MsgPackWriter(OutputStream& os)
+        : m_os(&os)
+    {
+    }
+
+    bool Null()
+    {
+        start_value();
+        put(msgpack::kNil);
+        return end_value();
+    }
+
+    bool Bool(bool b)
+    {
+        start_value();
+        put(b ? msgpack::kTrue : msgpack::kFalse);
+        return end_value();
+    }
+
+    bool Int(int i)
+    {
+        start_value();
+        put_signed(i);
+        return end_value();
+    }
+
+    bool Uint(unsigned i)
+    {
+        start_value();
+        put_unsigned(i);
+        return end_value();
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        start_value();
+        put_signed(i);
+        return end_value();
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        start_value();
+        put_unsigned(i);
+        return end_value();
+    }
+
+    bool Double(double d)
+    {
+        start_value();
+        utility::uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        put(msgpack::kFloat64);
+        put_big_endian(bits, 8);
+        return end_value();
+    }
+
+    bool String(const Ch* str, SizeType length, bool = false)
+    {
+        start_value();
+        put_string(str, length);
+        return end_value();
+    }
+
+    bool Key(const Ch* str, SizeType length, bool = false)
+    {
+        assert(!m_open.empty() && m_containers[m_open.back()].is_map);
+        ++m_containers[m_open.back()].count;
+        put_string(str, length);
+        return true;
+    }
+
+    bool StartObject()
+    {
+        return start_container(true);
+    }
+
+    bool EndObject(SizeType = 0)
+    {
+        return end_container();
+    }
+
+    bool StartArray()
+    {
+        return start_container(false);
+    }
+
+    bool EndArray(SizeType = 0)
+    {
+        return end_container();
+    }
+};
+
+// Reads MessagePack and drives a handler with the same events `rapidjson::Reader` produces for the
+// equivalent JSON, so every `SAXEventHandler` works unchanged. Maps must have string keys.
+// Binary data is delivered as strings; extension types are rejected.
+// Strings point into the input, which must outlive the parsing.
+class MsgPackReader {
+private:
+    struct Frame {
+        utility::uint64_t remaining;
+        SizeType total;
+        bool is_map;
+        bool expect_key;
+    };
+
+    const unsigned char* m_begin;
+    const unsigned char* m_cur;
+    const unsigned char* m_end;
+    std::vector<Frame> m_stack;
+
+    rapidjson::ParseResult error(rapidjson::ParseErrorCode code) const
+    {
+        return rapidjson::ParseResult(code, static_cast<std::size_t>(m_cur - m_begin));
+    }
+
+    bool read_big_endian(int bytes, utility::uint64_t& value)
+    {
+        if (m_end - m_cur < bytes)
+            return false;
+        value = 0;
+        for (int i = 0; i < bytes; ++i)
+            value = (value << 8) | *m_cur++;
+        return true;
+    }
+
+    // Read the payload of a string or binary, whose header byte has been consumed
+    bool read_bytes(utility::uint64_t length, const char*& data)
+    {
+        if (static_cast<utility::uint64_t>(m_end - m_cur) < length)
+            return false;
+        data = reinterpret_cast<const char*>(m_cur);
+        m_cur += length;
+        return true;
+    }
+
+    // Decode the header of a string; returns false if the next value is not a string
+    bool read_string_header(unsigned char type, utility::uint64_t& length, bool& truncated)
+    {
+        truncated = false;
+        if ((type & 0xe0) == 0xa0) {
+            length = type & 0x1f;
+            return true;
+        }
+        int bytes;
+        switch (type) {
+        case msgpack::kStr8:
+        case msgpack::kBin8:
+            bytes = 1;
+            break;
+        case msgpack::kStr16:
+        case msgpack::kBin16:
+            bytes = 2;
+            break;
+        case msgpack::kStr32:
+        case msgpack::kBin32:
+            bytes = 4;
+            break;
+        default:
+            return false;
+        }
+        truncated = !read_big_endian(bytes, length);
+        return true;
+    }
+
+    template <class Handler>
+    static bool forward_unsigned(Handler& handler, utility::uint64_t value)
+    {
+        if (value <= 0xFFFFFFFFu)
+            return handler.Uint(static_cast<unsigned>(value));
+        return handler.Uint64(value);
+    }
+
+    template <class Handler>
+    static bool forward_signed(Handler& handler, utility::int64_t value)
+    {
+        if (value >= 0)
+            return forward_unsigned(handler, static_cast<utility::uint64_t>(value));
+        if (value >= -2147483647 - 1)
+            return handler.Int(static_cast<int>(value));
+        return handler.Int64(value);
+    }
+
+    static utility::int64_t sign_extend(utility::uint64_t value, int bytes)
+    {
+        if (bytes < 8 && (value >> (8 * bytes - 1)) & 1)
+            value |= ~utility::uint64_t(0) << (8 * bytes);
+        return static_cast<utility::int64_t>(value);
+    }
+
+    bool push_frame(utility::uint64_t count, bool is_map)
+    {
+        // Every element takes at least one byte, which bounds bogus counts
+        utility::uint64_t available = static_cast<utility::uint64_t>(m_end - m_cur);
+        if (count > (is_map ? available / 2 : available))
+            return false;
+        Frame f;
+        f.remaining = count;
+        f.total = static_cast<SizeType>(count);
+        f.is_map = is_map;
+        f.expect_key = is_map;
+        m_stack.push_back(f);
+        return true;
+    }
+
+    void value_completed()
+    {
+        if (!m_stack.empty()) {
+            Frame& f = m_stack.back();
+            --f.remaining;
+            f.expect_key = f.is_map;
+        }
+    }
+
+public:
+    explicit MsgPackReader()
+        : m_begin(0)
+        , m_cur(0)
+        , m_end(0)
+    {
+    }
+
+    template <class Handler>
+    rapidjson::ParseResult Parse(const char* data, std::size_t length, Handler& handler)
+    {
+        m_begin = m_cur = reinterpret_cast<const unsigned char*>(data);
+        m_end = m_begin + length;
+        m_stack.clear();
+
+        if (m_cur == m_end)
+            return error(rapidjson::kParseErrorDocumentEmpty);
+
+        do {
+            if (!m_stack.empty() && m_stack.back().remaining == 0) {
+                Frame f = m_stack.back();
+                m_stack.pop_back();
+                if (!(f.is_map ? handler.EndObject(f.total) : handler.EndArray(f.total)))
+                    return error(rapidjson::kParseErrorTermination);
+                value_completed();
+                continue;
+            }
+
+            if (m_cur == m_end)
+                return error(rapidjson::kParseErrorValueInvalid);
+
+            const unsigned char* start = m_cur;
+            unsigned char type = *m_cur++;
+            utility::uint64_t value = 0;
+            bool truncated = false;
+            bool ok = true;
+
+            if (!m_stack.empty() && m_stack.back().expect_key) {
+                const char* key;
+                if (!read_string_header(type, value, truncated)) {
+                    m_cur = start;
+                    return error(rapidjson::kParseErrorObjectMissName);
+                }
+                if (truncated || !read_bytes(value, key))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                if (!handler.Key(key, static_cast<SizeType>(value), true))
+                    return error(rapidjson::kParseErrorTermination);
+                m_stack.back().expect_key = false;
+                continue;
+            }
+
+            if (type < 0x80) {
+                ok = forward_unsigned(handler, type);
+            } else if (type >= 0xe0) {
+                ok = handler.Int(static_cast<int>(type) - 256);
+            } else if ((type & 0xf0) == 0x80 || (type & 0xf0) == 0x90) {
+                if (!push_frame(type & 0x0f, (type & 0xf0) == 0x80))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                if (!((type & 0xf0) == 0x80 ? handler.StartObject() : handler.StartArray()))
+                    return error(rapidjson::kParseErrorTermination);
+                continue;
+            } else if (read_string_header(type, value, truncated)) {
+                const char* str;
+                if (truncated || !read_bytes(value, str))
+                    return error(rapidjson::kParseErrorValueInvalid);
+                ok = handler.String(str, static_cast<SizeType>(value), true);
+            } else {
+                switch (type) {
+                case msgpack::kNil:
+                    ok = handler.Null();
+                    break;
+                case msgpack::kFalse:
+                    ok = handler.Bool(false);
+                    break;
+                case msgpack::kTrue:
+                    ok = handler.Bool(true);
+                    break;
+                case msgpack::kUint8:
+                case msgpack::kUint16:
+                case msgpack::kUint32:
+                case msgpack::kUint64:
+                    if (!read_big_endian(1 << (type - msgpack::kUint8), value))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    ok = forward_unsigned(handler, value);
+                    break;
+                case msgpack::kInt8:
+                case msgpack::kInt16:
+                case msgpack::kInt32:
+                case msgpack::kInt64:
+                    if (!read_big_endian(1 << (type - msgpack::kInt8), value))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    ok = forward_signed(handler, sign_extend(value, 1 << (type - msgpack::kInt8)));
+                    break;
+                case msgpack::kFloat32: {
+                    if (!read_big_endian(4, value))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    unsigned bits = static_cast<unsigned>(value);
+                    float f;
+                    std::memcpy(&f, &bits, sizeof(f));
+                    ok = handler.Double(f);
+                    break;
+                }
+                case msgpack::kFloat64: {
+                    if (!read_big_endian(8, value))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    double d;
+                    std::memcpy(&d, &value, sizeof(d));
+                    ok = handler.Double(d);
+                    break;
+                }
+                case msgpack::kArray16:
+                case msgpack::kArray32:
+                case msgpack::kMap16:
+                case msgpack::kMap32: {
+                    bool is_map = (type == msgpack::kMap16 || type == msgpack::kMap32);
+                    if (!read_big_endian((type & 1) ? 4 : 2, value) || !push_frame(value, is_map))
+                        return error(rapidjson::kParseErrorValueInvalid);
+                    if (!(is_map ? handler.StartObject() : handler.StartArray()))
+                        return error(rapidjson::kParseErrorTermination);
+                    continue;
+                }
+                default:
+                    m_cur = start;
+                    return error(rapidjson::kParseErrorValueInvalid);
+                }
+            }
+
+            if (!ok)
+                return error(rapidjson::kParseErrorTermination);
+            value_completed();
+        } while (!m_stack.empty());
+
+        if (m_cur != m_end)
+            return error(rapidjson::kParseErrorDocumentRootNotSingular);
+        return rapidjson::ParseResult();
+    }
+};
+
+template <class OutputStream, class ValueType>
+inline void to_msgpack(OutputStream& os, const ValueType& v)
+{
+    MsgPackWriter<OutputStream> writer(os);
+    Serializer<MsgPackWriter<OutputStream>, ValueType>()(writer, v);
+    os.Flush();
+}
+
+template <class ValueType>
+inline void to_msgpack_string(std::string& str, const ValueType& v)
+{
+    str.clear();
+    StringOutputStream os(str);
+    to_msgpack(os, v);
+}
+
+template <class ValueType>
+inline std::string to_msgpack_string(const ValueType& v)
+{
+    std::string result;
+    to_msgpack_string(result, v);
+    return result;
+}
+
+template <class ValueType>
+inline bool from_msgpack(const char* data, std::size_t length, ValueType& value, ParsingResult& result)
+{
+    typedef SAXEventHandler<ValueType> handler_type;
+
+    utility::scoped_ptr<handler_type> handler(new handler_type(&value));
+
+    MsgPackReader reader;
+    result.set_result(reader.Parse(data, length, *handler));
+    handler->ReapError(result.error_stack());
+    return !result.has_error();
+}
+
+template <class ValueType>
+inline bool from_msgpack_string(const std::string& data, ValueType& value, ParsingResult& result)
+{
+    return from_msgpack(data.data(), data.size(), value, result);
+}
+}
+
+#endif
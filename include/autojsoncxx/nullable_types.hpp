@@ -31,6 +31,10 @@
 #include <memory>
 #endif
 
+#if AUTOJSONCXX_HAS_OPTIONAL
+#include <optional>
+#endif
+
 namespace autojsoncxx {
 
 template <class ValueType, class Derived>
@@ -271,6 +275,153 @@ namespace utility {
     }
 }
 
+#endif
+
+#if AUTOJSONCXX_HAS_OPTIONAL
+// Both the value and the handler of the value are held inline, so that nothing is allocated
+template <class T>
+class SAXEventHandler<std::optional<T> > {
+private:
+    typedef std::optional<T> optional_type;
+
+    optional_type* m_value;
+    std::optional<SAXEventHandler<T> > internal_handler;
+    int depth;
+
+    void initialize()
+    {
+        if (!internal_handler) {
+            m_value->emplace();
+            internal_handler.emplace(&**m_value);
+        }
+    }
+
+public:
+    explicit SAXEventHandler(optional_type* v)
+        : m_value(v)
+        , depth(0)
+    {
+    }
+
+    bool Null()
+    {
+        if (depth == 0) {
+            internal_handler.reset();
+            m_value->reset();
+            return true;
+        }
+        return internal_handler->Null();
+    }
+
+    bool Bool(bool b)
+    {
+        initialize();
+        return internal_handler->Bool(b);
+    }
+
+    bool Int(int i)
+    {
+        initialize();
+        return internal_handler->Int(i);
+    }
+
+    bool Uint(unsigned i)
+    {
+        initialize();
+        return internal_handler->Uint(i);
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        initialize();
+        return internal_handler->Int64(i);
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        initialize();
+        return internal_handler->Uint64(i);
+    }
+
+    bool Double(double d)
+    {
+        initialize();
+        return internal_handler->Double(d);
+    }
+
+    bool String(const char* str, SizeType len, bool copy)
+    {
+        initialize();
+        return internal_handler->String(str, len, copy);
+    }
+
+    bool Key(const char* str, SizeType len, bool copy)
+    {
+        return internal_handler->Key(str, len, copy);
+    }
+
+    bool StartObject()
+    {
+        initialize();
+        ++depth;
+        return internal_handler->StartObject();
+    }
+
+    bool EndObject(SizeType len)
+    {
+        --depth;
+        return internal_handler->EndObject(len);
+    }
+
+    bool StartArray()
+    {
+        initialize();
+        ++depth;
+        return internal_handler->StartArray();
+    }
+
+    bool EndArray(SizeType len)
+    {
+        --depth;
+        return internal_handler->EndArray(len);
+    }
+
+    bool HasError() const
+    {
+        return internal_handler && internal_handler->HasError();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        return internal_handler && internal_handler->ReapError(errs);
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        internal_handler.reset();
+    }
+};
+
+template <class Writer, class T>
+struct Serializer<Writer, std::optional<T> > {
+    void operator()(Writer& w, const std::optional<T>& value) const
+    {
+        if (!value)
+            w.Null();
+        else
+            Serializer<Writer, T>()(w, *value);
+    }
+};
+
+namespace utility {
+    namespace traits {
+        template <class T>
+        struct is_simple_type<std::optional<T> > : public is_simple_type<T> {
+        };
+    }
+}
+
 #endif
 }
 #endif
@@ -0,0 +1,302 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef AUTOJSONCXX_NUMBER_FORMAT_HPP_29A4C106C1B1
+#define AUTOJSONCXX_NUMBER_FORMAT_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+
+#include <rapidjson/internal/dtoa.h>
+
+#include <cstddef>
+#include <cstring>
+
+namespace autojsoncxx {
+namespace utility {
+
+    // The maximum number of characters written by `format_double`
+    const std::size_t max_double_length = 32;
+
+    // The maximum number of characters written by `format_fixed_double`: a sign, the 309 digits
+    // of the largest double, the point and the decimals
+    const std::size_t max_fixed_double_length = 330;
+
+    // The largest number of decimals supported by `format_fixed_double`
+    const int max_fixed_precision = 17;
+
+    // Write the shortest representation of a finite double that parses back to the same value,
+    // exactly as `rapidjson::Writer` does. Returns the end of the output.
+    inline char* format_double(char* buffer, double d)
+    {
+        return rapidjson::internal::dtoa(d, buffer);
+    }
+
+    namespace internal {
+        // Unsigned 128-bit integer, just enough for the exact arithmetic of fixed point formatting
+        struct uint128 {
+            uint64_t hi, lo;
+        };
+
+        inline uint128 multiply(uint64_t a, uint64_t b)
+        {
+            const uint64_t mask = 0xFFFFFFFFu;
+            uint64_t a_lo = a & mask, a_hi = a >> 32, b_lo = b & mask, b_hi = b >> 32;
+            uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+            uint64_t cross = (lo_lo >> 32) + (hi_lo & mask) + lo_hi;
+
+            uint128 result;
+            result.hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+            result.lo = (cross << 32) | (lo_lo & mask);
+            return result;
+        }
+
+        inline bool bit_at(const uint128& x, int pos)
+        {
+            return pos < 64 ? ((x.lo >> pos) & 1) != 0 : ((x.hi >> (pos - 64)) & 1) != 0;
+        }
+
+        // Whether any of the bits below `pos` is set
+        inline bool any_bits_below(const uint128& x, int pos)
+        {
+            if (pos <= 0)
+                return false;
+            if (pos < 64)
+                return (x.lo & ((uint64_t(1) << pos) - 1)) != 0;
+            if (x.lo != 0)
+                return true;
+            return pos > 64 && (x.hi & ((uint64_t(1) << (pos - 64)) - 1)) != 0;
+        }
+
+        inline uint64_t double_bits(double d)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &d, sizeof(bits));
+            return bits;
+        }
+
+        inline uint64_t power_of_ten(int n)
+        {
+            uint64_t result = 1;
+            while (n-- > 0)
+                result *= 10;
+            return result;
+        }
+
+        // Compute `round(|d| * 10^precision)` exactly, rounding half to even like `printf`.
+        // Returns false if the result does not fit in 64 bits.
+        inline bool scale_and_round(double d, int precision, uint64_t& result)
+        {
+            uint64_t bits = double_bits(d);
+            int biased_exponent = static_cast<int>((bits >> 52) & 0x7FF);
+            uint64_t mantissa = bits & ((uint64_t(1) << 52) - 1);
+            int exponent;
+            if (biased_exponent == 0) {
+                exponent = -1074;
+            } else {
+                mantissa |= uint64_t(1) << 52;
+                exponent = biased_exponent - 1075;
+            }
+
+            // |d| * 10^precision == product * 2^exponent, and product < 2^117
+            uint128 product = multiply(mantissa, power_of_ten(precision));
+
+            if (exponent >= 0) {
+                if (product.hi != 0 || exponent >= 64 || (product.lo >> (63 - exponent)) > 1)
+                    return false;
+                result = product.lo << exponent;
+                return true;
+            }
+
+            int shift = -exponent;
+            if (shift >= 118) {
+                result = 0;
+                return true;
+            }
+
+            uint64_t quotient;
+            if (shift < 64) {
+                if ((product.hi >> shift) != 0)
+                    return false;
+                quotient = (product.lo >> shift) | (product.hi << (63 - shift) << 1);
+            } else {
+                quotient = product.hi >> (shift - 64);
+            }
+
+            if (bit_at(product, shift - 1) && (any_bits_below(product, shift - 1) || (quotient & 1))) {
+                if (quotient == ~uint64_t(0))
+                    return false;
+                ++quotient;
+            }
+            result = quotient;
+            return true;
+        }
+    }
+
+    inline bool is_finite(double d)
+    {
+        return ((internal::double_bits(d) >> 52) & 0x7FF) != 0x7FF;
+    }
+
+    // Round a double to the nearest multiple of 10^-precision, the value `format_fixed_double` writes
+    inline double round_to_decimals(double d, int precision)
+    {
+        uint64_t scaled;
+        if (!internal::scale_and_round(d, precision, scaled) || scaled >= (uint64_t(1) << 53))
+            return d;
+        double result = static_cast<double>(scaled) / static_cast<double>(internal::power_of_ten(precision));
+        return (internal::double_bits(d) >> 63) ? -result : result;
+    }
+
+    namespace internal {
+        inline char* write_unsigned(char* p, uint64_t value)
+        {
+            char digits[20];
+            int count = 0;
+            do {
+                digits[count++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            while (count > 0)
+                *p++ = digits[--count];
+            return p;
+        }
+
+        // Writes `mantissa * 2^exponent` exactly, for the doubles too large for 64 bits, all of which are
+        // integers. The number is held in 32-bit limbs and divided by 10^9 for each group of nine digits.
+        inline char* write_big_unsigned(char* p, uint64_t mantissa, int exponent)
+        {
+            const uint64_t mask = 0xFFFFFFFFu;
+            const uint64_t billion = 1000000000u;
+
+            uint64_t limbs[34] = { 0 };
+            int word = exponent / 32, bit = exponent % 32;
+            limbs[word] = (mantissa << bit) & mask;
+            limbs[word + 1] = (mantissa >> (32 - bit)) & mask;
+            limbs[word + 2] = bit == 0 ? 0 : mantissa >> (64 - bit);
+            int count = word + 3;
+
+            uint64_t groups[36];
+            int group_count = 0;
+            while (count > 0) {
+                uint64_t remainder = 0;
+                for (int i = count - 1; i >= 0; --i) {
+                    uint64_t current = (remainder << 32) | limbs[i];
+                    limbs[i] = current / billion;
+                    remainder = current % billion;
+                }
+                groups[group_count++] = remainder;
+                while (count > 0 && limbs[count - 1] == 0)
+                    --count;
+            }
+
+            p = write_unsigned(p, groups[--group_count]);
+            while (group_count > 0) {
+                uint64_t group = groups[--group_count];
+                for (int i = 8; i >= 0; --i) {
+                    p[i] = static_cast<char>('0' + group % 10);
+                    group /= 10;
+                }
+                p += 9;
+            }
+            return p;
+        }
+    }
+
+    // Write a finite double rounded to `precision` decimals (at most `max_fixed_precision`), with at most
+    // `max_fixed_double_length` characters. With `fixed` all the decimals are written, like `printf("%.*f")`
+    // in the C locale; otherwise trailing zeros are dropped but at least one decimal is kept.
+    // The integral and fractional parts are formatted separately, so that any magnitude is exact.
+    // Returns the end of the output.
+    inline char* format_fixed_double(char* buffer, double d, int precision, bool fixed)
+    {
+        uint64_t bits = internal::double_bits(d);
+        double magnitude = (bits >> 63) ? -d : d;
+
+        char* p = buffer;
+        if (bits >> 63)
+            *p++ = '-';
+
+        // The decimals, as an integer of `precision` digits
+        uint64_t fraction = 0;
+        if (magnitude < 9223372036854775808.0) {
+            uint64_t integral = static_cast<uint64_t>(magnitude);
+
+            // Exact, as is any difference between a double and its integral part
+            double rest = magnitude - static_cast<double>(integral);
+
+            // Rounding half to even looks at the last digit kept, which is integral without decimals
+            if (precision == 0) {
+                integral += rest > 0.5 || (rest == 0.5 && (integral & 1));
+            } else {
+                internal::scale_and_round(rest, precision, fraction);
+                if (fraction == internal::power_of_ten(precision)) {
+                    ++integral;
+                    fraction = 0;
+                }
+            }
+            p = internal::write_unsigned(p, integral);
+        } else {
+            p = internal::write_big_unsigned(
+                p, (bits & ((uint64_t(1) << 52) - 1)) | (uint64_t(1) << 52), static_cast<int>((bits >> 52) & 0x7FF) - 1075);
+        }
+
+        char digits[max_fixed_precision];
+        for (int i = precision - 1; i >= 0; --i) {
+            digits[i] = static_cast<char>('0' + fraction % 10);
+            fraction /= 10;
+        }
+
+        int decimals = precision;
+        if (!fixed) {
+            while (decimals > 1 && digits[decimals - 1] == '0')
+                --decimals;
+        }
+
+        if (decimals > 0) {
+            *p++ = '.';
+            for (int i = 0; i < decimals; ++i)
+                *p++ = digits[i];
+        } else if (!fixed) {
+            *p++ = '.';
+            *p++ = '0';
+        }
+        return p;
+    }
+
+    // The fewest decimals with which a float reads back as the same float, or -1 for nonzero magnitudes
+    // outside [1e-5, 2^24), whose shortest form needs an exponent
+    inline int float_decimals(float f)
+    {
+        double d = f;
+        double magnitude = d < 0 ? -d : d;
+        if (!(magnitude < 16777216.0) || (magnitude < 1e-5 && magnitude != 0))
+            return -1;
+        for (int precision = 0; precision < max_fixed_precision; ++precision) {
+            if (static_cast<float>(round_to_decimals(d, precision)) == f)
+                return precision;
+        }
+        return -1;
+    }
+}
+}
+
+#endif
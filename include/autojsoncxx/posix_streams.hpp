@@ -0,0 +1,374 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef AUTOJSONCXX_POSIX_STREAMS_HPP_29A4C106C1B1
+#define AUTOJSONCXX_POSIX_STREAMS_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/to_json.hpp>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+namespace autojsoncxx {
+namespace utility {
+
+    const std::size_t default_large_buffer_size = 1 << 20;
+
+    inline bool write_all(int fd, const char* data, std::size_t size)
+    {
+        while (size > 0) {
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+    // The iovec array is modified in place to keep track of partial writes
+    inline bool writev_all(int fd, struct iovec* iov, int count)
+    {
+        while (count > 0) {
+            ssize_t written = ::writev(fd, iov, count);
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            while (count > 0 && static_cast<std::size_t>(written) >= iov->iov_len) {
+                written -= static_cast<ssize_t>(iov->iov_len);
+                ++iov;
+                --count;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+                iov->iov_len -= static_cast<std::size_t>(written);
+            }
+        }
+        return true;
+    }
+}
+
+// An output stream writing to a file descriptor through a large buffer,
+// so that a huge dump costs few system calls instead of one `fwrite` per 256 bytes.
+// The descriptor is not owned by the stream.
+class FileDescriptorWriteStream {
+private:
+    int m_fd;
+    std::vector<char> m_buffer;
+    std::size_t m_size;
+    bool m_failed;
+
+    FileDescriptorWriteStream(const FileDescriptorWriteStream&);
+    FileDescriptorWriteStream& operator=(const FileDescriptorWriteStream&);
+
+public:
+    typedef char Ch;
+
+    explicit FileDescriptorWriteStream(int fd, std::size_t buffer_size = utility::default_large_buffer_size)
+        : m_fd(fd)
+        , m_buffer(std::max<std::size_t>(buffer_size, 1))
+        , m_size(0)
+        , m_failed(false)
+    {
+    }
+
+    ~FileDescriptorWriteStream()
+    {
+        Flush();
+    }
+
+    void Put(char c)
+    {
+        if (m_size == m_buffer.size())
+            Flush();
+        m_buffer[m_size++] = c;
+    }
+
+    void Write(const char* data, std::size_t length)
+    {
+        while (length > 0) {
+            if (m_size == m_buffer.size())
+                Flush();
+            std::size_t n = std::min(length, m_buffer.size() - m_size);
+            std::memcpy(&m_buffer[m_size], data, n);
+            m_size += n;
+            data += n;
+            length -= n;
+        }
+    }
+
+    void Flush()
+    {
+        if (m_size > 0 && !m_failed)
+            m_failed = !utility::write_all(m_fd, &m_buffer[0], m_size);
+        m_size = 0;
+    }
+
+    // Write the buffered content followed by pre-built chunks, with as few `writev` calls as possible
+    void PutChunks(const struct iovec* chunks, int count)
+    {
+#ifdef IOV_MAX
+        const int max_iov = IOV_MAX;
+#else
+        const int max_iov = 16;
+#endif
+        std::vector<struct iovec> iov;
+        iov.reserve(std::min(count + 1, max_iov));
+
+        if (m_size > 0) {
+            struct iovec buffered;
+            buffered.iov_base = &m_buffer[0];
+            buffered.iov_len = m_size;
+            iov.push_back(buffered);
+            m_size = 0;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            iov.push_back(chunks[i]);
+            if (static_cast<int>(iov.size()) == max_iov) {
+                if (!m_failed)
+                    m_failed = !utility::writev_all(m_fd, &iov[0], static_cast<int>(iov.size()));
+                iov.clear();
+            }
+        }
+
+        if (!iov.empty() && !m_failed)
+            m_failed = !utility::writev_all(m_fd, &iov[0], static_cast<int>(iov.size()));
+    }
+
+    // Reserve disk blocks for the expected amount of output starting at the current offset.
+    // The file size is left untouched, so an overestimate leaves no trailing garbage.
+    // Returns false when preallocation is unsupported or fails; writing works regardless.
+    bool Preallocate(std::size_t expected_size)
+    {
+#if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+        off_t offset = ::lseek(m_fd, 0, SEEK_CUR);
+        if (offset < 0)
+            return false;
+        return ::fallocate(m_fd, FALLOC_FL_KEEP_SIZE, offset + static_cast<off_t>(m_size),
+                           static_cast<off_t>(expected_size)) == 0;
+#else
+        (void)expected_size;
+        return false;
+#endif
+    }
+
+    bool has_error() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_failed;
+    }
+};
+
+inline void put_range(FileDescriptorWriteStream& os, const char* data, std::size_t length)
+{
+    os.Write(data, length);
+}
+
+// An output stream writing into a memory mapping of the file, for results whose size is known beforehand.
+// The file is resized to `capacity` bytes from offset zero, and truncated to the number of bytes
+// actually written on `Close()`. Writing past the capacity is reported as an error.
+class MemoryMappedWriteStream {
+private:
+    int m_fd;
+    char* m_begin;
+    std::size_t m_capacity;
+    std::size_t m_size;
+    bool m_failed;
+
+    MemoryMappedWriteStream(const MemoryMappedWriteStream&);
+    MemoryMappedWriteStream& operator=(const MemoryMappedWriteStream&);
+
+public:
+    typedef char Ch;
+
+    explicit MemoryMappedWriteStream(int fd, std::size_t capacity)
+        : m_fd(fd)
+        , m_begin(0)
+        , m_capacity(0)
+        , m_size(0)
+        , m_failed(true)
+    {
+        // Without a mapping the capacity stays zero, so every write is reported as an error
+        if (capacity > 0 && ::ftruncate(fd, static_cast<off_t>(capacity)) == 0) {
+            void* p = ::mmap(0, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p != MAP_FAILED) {
+                m_begin = static_cast<char*>(p);
+                m_capacity = capacity;
+                m_failed = false;
+            }
+        }
+    }
+
+    ~MemoryMappedWriteStream()
+    {
+        Close();
+    }
+
+    void Put(char c)
+    {
+        if (m_size < m_capacity)
+            m_begin[m_size++] = c;
+        else
+            m_failed = true;
+    }
+
+    void Write(const char* data, std::size_t length)
+    {
+        std::size_t room = m_size < m_capacity ? m_capacity - m_size : 0;
+        if (room < length) {
+            length = room;
+            m_failed = true;
+        }
+        if (length > 0) {
+            std::memcpy(m_begin + m_size, data, length);
+            m_size += length;
+        }
+    }
+
+    void Flush()
+    {
+    }
+
+    bool Close()
+    {
+        if (m_begin) {
+            ::munmap(m_begin, m_capacity);
+            m_begin = 0;
+            m_capacity = 0;
+            if (::ftruncate(m_fd, static_cast<off_t>(m_size)) != 0)
+                m_failed = true;
+        }
+        return !m_failed;
+    }
+
+    std::size_t size() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_size;
+    }
+
+    bool has_error() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_failed;
+    }
+};
+
+inline void put_range(MemoryMappedWriteStream& os, const char* data, std::size_t length)
+{
+    os.Write(data, length);
+}
+
+// A read-only memory mapping of a whole file, such as a snapshot to be viewed in place
+class MemoryMappedFile {
+private:
+    const char* m_data;
+    std::size_t m_size;
+    bool m_failed;
+
+    MemoryMappedFile(const MemoryMappedFile&);
+    MemoryMappedFile& operator=(const MemoryMappedFile&);
+
+public:
+    explicit MemoryMappedFile(int fd)
+        : m_data(0)
+        , m_size(0)
+        , m_failed(true)
+    {
+        off_t size = ::lseek(fd, 0, SEEK_END);
+        if (size == 0) {
+            m_failed = false;
+        } else if (size > 0) {
+            void* p = ::mmap(0, static_cast<std::size_t>(size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                m_data = static_cast<const char*>(p);
+                m_size = static_cast<std::size_t>(size);
+                m_failed = false;
+            }
+        }
+    }
+
+    ~MemoryMappedFile()
+    {
+        if (m_data)
+            ::munmap(const_cast<char*>(m_data), m_size);
+    }
+
+    const char* data() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_data;
+    }
+
+    std::size_t size() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_size;
+    }
+
+    bool has_error() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_failed;
+    }
+};
+
+template <class ValueType, class WriterPolicy>
+inline bool to_json_fd(int fd, const ValueType& v, std::size_t BufferSize, WriterPolicy policy)
+{
+    FileDescriptorWriteStream os(fd, BufferSize);
+    to_json(os, v, policy);
+    os.Flush();
+    return !os.has_error();
+}
+
+template <class ValueType>
+inline bool to_json_fd(int fd, const ValueType& v,
+                       std::size_t BufferSize = utility::default_large_buffer_size)
+{
+    return to_json_fd(fd, v, BufferSize, CheckedWriterPolicy());
+}
+
+template <class ValueType>
+inline bool to_pretty_json_fd(int fd, const ValueType& v,
+                              std::size_t BufferSize = utility::default_large_buffer_size)
+{
+    FileDescriptorWriteStream os(fd, BufferSize);
+    to_pretty_json(os, v);
+    os.Flush();
+    return !os.has_error();
+}
+}
+
+#endif
@@ -0,0 +1,696 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef AUTOJSONCXX_SNAPSHOT_HPP_29A4C106C1B1
+#define AUTOJSONCXX_SNAPSHOT_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/array_types.hpp>
+#include <autojsoncxx/map_types.hpp>
+#include <autojsoncxx/nullable_types.hpp>
+#include <autojsoncxx/to_json.hpp>
+#include <autojsoncxx/binary.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autojsoncxx {
+
+// A snapshot is a file laid out so that values are read in place, without parsing, typically
+// from a memory mapping. Every value occupies an eight byte slot: numbers are stored in the slot
+// itself, everything else in the slot as the offset of its data from the start of the file,
+// with zero for empty strings, empty arrays and null pointers. The file starts with a header,
+// whose last field is the slot of the root value.
+namespace snapshot {
+    static const char magic[] = { 'A', 'J', 'X', 'S' };
+    static const unsigned byte_order_mark = 0x01020304u;
+    static const std::size_t slot_size = 8;
+    static const std::size_t root_slot = 16;
+    static const std::size_t header_size = root_slot + slot_size;
+
+    // The bytes of a snapshot. Reads out of bounds return zero, so views of a truncated
+    // or corrupted file yield empty values instead of touching memory outside of it.
+    class Region {
+    private:
+        const char* m_base;
+        std::size_t m_size;
+
+    public:
+        explicit Region()
+            : m_base(0)
+            , m_size(0)
+        {
+        }
+
+        explicit Region(const char* base, std::size_t size)
+            : m_base(base)
+            , m_size(size)
+        {
+        }
+
+        bool contains(utility::uint64_t offset, utility::uint64_t length) const
+        {
+            return offset <= m_size && length <= m_size - offset;
+        }
+
+        const char* at(utility::uint64_t offset) const
+        {
+            return m_base + offset;
+        }
+
+        template <class T>
+        T read(utility::uint64_t offset) const
+        {
+            T value = T();
+            if (contains(offset, sizeof(T)))
+                std::memcpy(&value, m_base + offset, sizeof(T));
+            return value;
+        }
+
+        utility::uint64_t read_offset(utility::uint64_t slot) const
+        {
+            return read<utility::uint64_t>(slot);
+        }
+    };
+}
+
+// Accumulates a snapshot in memory; data is only ever appended, so offsets stay valid
+class SnapshotBuilder {
+private:
+    std::string m_buffer;
+
+    SnapshotBuilder(const SnapshotBuilder&);
+    SnapshotBuilder& operator=(const SnapshotBuilder&);
+
+public:
+    explicit SnapshotBuilder()
+    {
+    }
+
+    // Reserve zeroed space for `length` bytes, aligned to the slot size
+    std::size_t allocate(std::size_t length)
+    {
+        std::size_t offset = m_buffer.size();
+        std::size_t padded = (length + snapshot::slot_size - 1) / snapshot::slot_size * snapshot::slot_size;
+        m_buffer.append(padded, '\0');
+        return offset;
+    }
+
+    void store(std::size_t offset, const void* data, std::size_t length)
+    {
+        std::memcpy(&m_buffer[offset], data, length);
+    }
+
+    template <class T>
+    void store_value(std::size_t slot, T value)
+    {
+        store(slot, &value, sizeof(value));
+    }
+
+    void store_offset(std::size_t slot, std::size_t offset)
+    {
+        store_value(slot, static_cast<utility::uint64_t>(offset));
+    }
+
+    // Append a length prefixed, null terminated run of bytes and point `slot` to it
+    void store_bytes(std::size_t slot, const char* data, std::size_t length)
+    {
+        if (length == 0)
+            return;
+        std::size_t offset = allocate(snapshot::slot_size + length + 1);
+        store_value(offset, static_cast<utility::uint64_t>(length));
+        store(offset + snapshot::slot_size, data, length);
+        store_offset(slot, offset);
+    }
+
+    const std::string& buffer() const
+    {
+        return m_buffer;
+    }
+};
+
+// How a type is stored in a snapshot, and the type through which it is read back.
+// Types without a specialization are stored in the binary format and decoded on access.
+template <class T>
+struct SnapshotTraits;
+
+// The view of a generated class, with one accessor per member
+template <class T>
+class SnapshotView;
+
+namespace snapshot {
+    class StringView {
+    private:
+        const char* m_data;
+        std::size_t m_size;
+
+    public:
+        explicit StringView()
+            : m_data("")
+            , m_size(0)
+        {
+        }
+
+        explicit StringView(const Region& region, utility::uint64_t offset)
+            : m_data("")
+            , m_size(0)
+        {
+            utility::uint64_t size = region.read<utility::uint64_t>(offset);
+            if (offset != 0 && region.contains(offset + slot_size, size)) {
+                m_data = region.at(offset + slot_size);
+                m_size = static_cast<std::size_t>(size);
+            }
+        }
+
+        const char* data() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_data;
+        }
+
+        std::size_t size() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_size;
+        }
+
+        bool empty() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_size == 0;
+        }
+
+        std::string str() const
+        {
+            return std::string(m_data, m_size);
+        }
+
+        // Compares bytewise, like `std::string::compare`
+        int compare(const char* str, std::size_t length) const
+        {
+            int result = std::memcmp(m_data, str, std::min(m_size, length));
+            if (result != 0)
+                return result;
+            return m_size < length ? -1 : (m_size > length ? 1 : 0);
+        }
+
+        bool operator==(const std::string& other) const
+        {
+            return compare(other.data(), other.size()) == 0;
+        }
+
+        bool operator!=(const std::string& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    // Elements of arrays are stored in consecutive slots after the count
+    template <class T>
+    class ListView {
+    private:
+        Region m_region;
+        utility::uint64_t m_offset;
+        std::size_t m_size;
+
+    public:
+        typedef typename SnapshotTraits<T>::view_type value_type;
+
+        explicit ListView()
+            : m_region()
+            , m_offset(0)
+            , m_size(0)
+        {
+        }
+
+        explicit ListView(const Region& region, utility::uint64_t offset)
+            : m_region(region)
+            , m_offset(offset)
+            , m_size(0)
+        {
+            utility::uint64_t size = region.read<utility::uint64_t>(offset);
+            if (offset != 0 && size <= (utility::uint64_t(-1) - slot_size) / slot_size
+                && region.contains(offset + slot_size, size * slot_size))
+                m_size = static_cast<std::size_t>(size);
+        }
+
+        std::size_t size() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_size;
+        }
+
+        bool empty() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_size == 0;
+        }
+
+        value_type operator[](std::size_t index) const
+        {
+            if (index >= m_size)
+                return SnapshotTraits<T>::view(Region(), 0);
+            return SnapshotTraits<T>::view(m_region, m_offset + slot_size * (1 + index));
+        }
+    };
+
+    // Entries of maps are stored as pairs of slots, sorted by key, so lookup is a binary search
+    template <class T>
+    class MapView {
+    private:
+        Region m_region;
+        utility::uint64_t m_offset;
+        std::size_t m_size;
+
+    public:
+        typedef typename SnapshotTraits<T>::view_type value_type;
+
+        explicit MapView()
+            : m_region()
+            , m_offset(0)
+            , m_size(0)
+        {
+        }
+
+        explicit MapView(const Region& region, utility::uint64_t offset)
+            : m_region(region)
+            , m_offset(offset)
+            , m_size(0)
+        {
+            utility::uint64_t size = region.read<utility::uint64_t>(offset);
+            if (offset != 0 && size <= (utility::uint64_t(-1) - slot_size) / (2 * slot_size)
+                && region.contains(offset + slot_size, size * 2 * slot_size))
+                m_size = static_cast<std::size_t>(size);
+        }
+
+        std::size_t size() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_size;
+        }
+
+        bool empty() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_size == 0;
+        }
+
+        StringView key(std::size_t index) const
+        {
+            if (index >= m_size)
+                return StringView();
+            return StringView(m_region, m_region.read_offset(m_offset + slot_size * (1 + 2 * index)));
+        }
+
+        value_type value(std::size_t index) const
+        {
+            if (index >= m_size)
+                return SnapshotTraits<T>::view(Region(), 0);
+            return SnapshotTraits<T>::view(m_region, m_offset + slot_size * (2 + 2 * index));
+        }
+
+        // Returns the index of the first entry with the key, or `size()` if there is none
+        std::size_t find(const char* str, std::size_t length) const
+        {
+            std::size_t low = 0, high = m_size;
+            while (low < high) {
+                std::size_t mid = low + (high - low) / 2;
+                if (key(mid).compare(str, length) < 0)
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            return (low < m_size && key(low).compare(str, length) == 0) ? low : m_size;
+        }
+
+        std::size_t find(const std::string& str) const
+        {
+            return find(str.data(), str.size());
+        }
+    };
+
+    // A null pointer is stored as a zero offset, otherwise the offset of a slot with the value
+    template <class T>
+    class NullableView {
+    private:
+        Region m_region;
+        utility::uint64_t m_offset;
+
+    public:
+        typedef typename SnapshotTraits<T>::view_type value_type;
+
+        explicit NullableView()
+            : m_region()
+            , m_offset(0)
+        {
+        }
+
+        explicit NullableView(const Region& region, utility::uint64_t offset)
+            : m_region(region)
+            , m_offset(region.contains(offset, slot_size) ? offset : 0)
+        {
+        }
+
+        bool is_null() const AUTOJSONCXX_NOEXCEPT
+        {
+            return m_offset == 0;
+        }
+
+        value_type get() const
+        {
+            return SnapshotTraits<T>::view(is_null() ? Region() : m_region, m_offset);
+        }
+    };
+
+    // Values of types without a layout of their own, decoded from the binary format on access
+    template <class T>
+    class OpaqueView {
+    private:
+        StringView m_encoded;
+
+    public:
+        explicit OpaqueView()
+            : m_encoded()
+        {
+        }
+
+        explicit OpaqueView(const Region& region, utility::uint64_t offset)
+            : m_encoded(region, offset)
+        {
+        }
+
+        bool decode(T& value) const
+        {
+            error::ErrorStack errors;
+            BinaryInput in(m_encoded.data(), m_encoded.size(), errors);
+            return BinaryCodec<T>::read(in, value) && in.at_end();
+        }
+    };
+
+    // Numbers are stored in the slot itself
+    template <class T>
+    struct ScalarSnapshotTraits {
+        typedef T view_type;
+
+        static void write(SnapshotBuilder& builder, std::size_t slot, T value)
+        {
+            builder.store_value(slot, value);
+        }
+
+        static view_type view(const Region& region, utility::uint64_t slot)
+        {
+            return region.read<T>(slot);
+        }
+    };
+
+    template <class Container, class ValueType>
+    struct ListSnapshotTraits {
+        typedef ListView<ValueType> view_type;
+
+        static void write(SnapshotBuilder& builder, std::size_t slot, const Container& value)
+        {
+            std::size_t count = static_cast<std::size_t>(std::distance(value.begin(), value.end()));
+            if (count == 0)
+                return;
+            std::size_t offset = builder.allocate(slot_size * (1 + count));
+            builder.store_value(offset, static_cast<utility::uint64_t>(count));
+            builder.store_offset(slot, offset);
+            std::size_t element = offset + slot_size;
+            for (typename Container::const_iterator it = value.begin(), end = value.end(); it != end; ++it) {
+                SnapshotTraits<ValueType>::write(builder, element, *it);
+                element += slot_size;
+            }
+        }
+
+        static view_type view(const Region& region, utility::uint64_t slot)
+        {
+            return view_type(region, region.read_offset(slot));
+        }
+    };
+
+    template <class MapType, class ElementType>
+    struct MapSnapshotTraits {
+        typedef MapView<ElementType> view_type;
+        typedef typename MapType::const_iterator const_iterator;
+
+        static void write(SnapshotBuilder& builder, std::size_t slot, const MapType& value)
+        {
+            if (value.empty())
+                return;
+
+            std::vector<const_iterator> sorted;
+            sorted.reserve(value.size());
+            for (const_iterator it = value.begin(), end = value.end(); it != end; ++it)
+                sorted.push_back(it);
+            std::stable_sort(sorted.begin(), sorted.end(), MapIteratorKeyLess<const_iterator>());
+
+            std::size_t offset = builder.allocate(slot_size * (1 + 2 * sorted.size()));
+            builder.store_value(offset, static_cast<utility::uint64_t>(sorted.size()));
+            builder.store_offset(slot, offset);
+            std::size_t entry = offset + slot_size;
+            for (std::size_t i = 0; i < sorted.size(); ++i) {
+                builder.store_bytes(entry, sorted[i]->first.data(), sorted[i]->first.size());
+                SnapshotTraits<ElementType>::write(builder, entry + slot_size, sorted[i]->second);
+                entry += 2 * slot_size;
+            }
+        }
+
+        static view_type view(const Region& region, utility::uint64_t slot)
+        {
+            return view_type(region, region.read_offset(slot));
+        }
+    };
+
+    template <class Pointer, class T>
+    struct NullableSnapshotTraits {
+        typedef NullableView<T> view_type;
+
+        static void write(SnapshotBuilder& builder, std::size_t slot, const Pointer& value)
+        {
+            if (!value)
+                return;
+            std::size_t offset = builder.allocate(slot_size);
+            builder.store_offset(slot, offset);
+            SnapshotTraits<T>::write(builder, offset, *value);
+        }
+
+        static view_type view(const Region& region, utility::uint64_t slot)
+        {
+            return view_type(region, region.read_offset(slot));
+        }
+    };
+}
+
+template <class T>
+struct SnapshotTraits {
+    typedef snapshot::OpaqueView<T> view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const T& value)
+    {
+        BinaryOutput out;
+        BinaryCodec<T>::write(out, value);
+        std::string encoded;
+        StringOutputStream os(encoded);
+        out.flush_to(os);
+        builder.store_bytes(slot, encoded.data(), encoded.size());
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+
+template <>
+struct SnapshotTraits<bool> : public snapshot::ScalarSnapshotTraits<bool> {
+};
+
+template <>
+struct SnapshotTraits<char> : public snapshot::ScalarSnapshotTraits<char> {
+};
+
+template <>
+struct SnapshotTraits<int> : public snapshot::ScalarSnapshotTraits<int> {
+};
+
+template <>
+struct SnapshotTraits<unsigned> : public snapshot::ScalarSnapshotTraits<unsigned> {
+};
+
+template <>
+struct SnapshotTraits<utility::int8_t> : public snapshot::ScalarSnapshotTraits<utility::int8_t> {
+};
+
+template <>
+struct SnapshotTraits<utility::uint8_t> : public snapshot::ScalarSnapshotTraits<utility::uint8_t> {
+};
+
+template <>
+struct SnapshotTraits<utility::int16_t> : public snapshot::ScalarSnapshotTraits<utility::int16_t> {
+};
+
+template <>
+struct SnapshotTraits<utility::uint16_t> : public snapshot::ScalarSnapshotTraits<utility::uint16_t> {
+};
+
+template <>
+struct SnapshotTraits<utility::int64_t> : public snapshot::ScalarSnapshotTraits<utility::int64_t> {
+};
+
+template <>
+struct SnapshotTraits<utility::uint64_t> : public snapshot::ScalarSnapshotTraits<utility::uint64_t> {
+};
+
+template <>
+struct SnapshotTraits<double> : public snapshot::ScalarSnapshotTraits<double> {
+};
+
+template <>
+struct SnapshotTraits<float> : public snapshot::ScalarSnapshotTraits<float> {
+};
+
+template <>
+struct SnapshotTraits<std::string> {
+    typedef snapshot::StringView view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const std::string& value)
+    {
+        builder.store_bytes(slot, value.data(), value.size());
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+
+template <class T, class Allocator>
+struct SnapshotTraits<std::vector<T, Allocator> >
+    : public snapshot::ListSnapshotTraits<std::vector<T, Allocator>, T> {
+};
+
+template <class T, class Allocator>
+struct SnapshotTraits<std::deque<T, Allocator> >
+    : public snapshot::ListSnapshotTraits<std::deque<T, Allocator>, T> {
+};
+
+template <class ElementType, class Compare, class Allocator>
+struct SnapshotTraits<std::map<std::string, ElementType, Compare, Allocator> >
+    : public snapshot::MapSnapshotTraits<std::map<std::string, ElementType, Compare, Allocator>, ElementType> {
+};
+
+template <class ElementType, class Compare, class Allocator>
+struct SnapshotTraits<std::multimap<std::string, ElementType, Compare, Allocator> >
+    : public snapshot::MapSnapshotTraits<std::multimap<std::string, ElementType, Compare, Allocator>, ElementType> {
+};
+
+#if AUTOJSONCXX_HAS_MODERN_TYPES
+
+template <class T, std::size_t N>
+struct SnapshotTraits<std::array<T, N> > : public snapshot::ListSnapshotTraits<std::array<T, N>, T> {
+};
+
+template <class ElementType, class Hash, class Equal, class Allocator>
+struct SnapshotTraits<std::unordered_map<std::string, ElementType, Hash, Equal, Allocator> >
+    : public snapshot::MapSnapshotTraits<std::unordered_map<std::string, ElementType, Hash, Equal, Allocator>,
+                                         ElementType> {
+};
+
+template <class ElementType, class Hash, class Equal, class Allocator>
+struct SnapshotTraits<std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator> >
+    : public snapshot::MapSnapshotTraits<std::unordered_multimap<std::string, ElementType, Hash, Equal, Allocator>,
+                                         ElementType> {
+};
+
+template <class T>
+struct SnapshotTraits<std::shared_ptr<T> > : public snapshot::NullableSnapshotTraits<std::shared_ptr<T>, T> {
+};
+
+template <class T, class Deleter>
+struct SnapshotTraits<std::unique_ptr<T, Deleter> >
+    : public snapshot::NullableSnapshotTraits<std::unique_ptr<T, Deleter>, T> {
+};
+
+#endif
+
+template <class ValueType>
+inline utility::uint64_t snapshot_fingerprint()
+{
+    return binary::type_fingerprint("snapshot", BinaryCodec<ValueType>::fingerprint());
+}
+
+template <class OutputStream, class ValueType>
+inline void write_snapshot(OutputStream& os, const ValueType& v)
+{
+    SnapshotBuilder builder;
+    std::size_t header = builder.allocate(snapshot::header_size);
+    builder.store(header, snapshot::magic, sizeof(snapshot::magic));
+    builder.store_value(header + sizeof(snapshot::magic), snapshot::byte_order_mark);
+    builder.store_value(header + 8, snapshot_fingerprint<ValueType>());
+    SnapshotTraits<ValueType>::write(builder, header + snapshot::root_slot, v);
+
+    const std::string& buffer = builder.buffer();
+    put_range(os, buffer.data(), buffer.size());
+    os.Flush();
+}
+
+template <class ValueType>
+inline std::string write_snapshot(const ValueType& v)
+{
+    std::string result;
+    StringOutputStream os(result);
+    write_snapshot(os, v);
+    return result;
+}
+
+// Checks the header of a snapshot and returns the view of its root value. The data is not
+// copied and must outlive the view; the values themselves are only read on access.
+template <class ValueType>
+inline bool open_snapshot(const char* data, std::size_t length,
+                          typename SnapshotTraits<ValueType>::view_type& view, ParsingResult& result)
+{
+    result.set_result(rapidjson::ParseResult());
+    if (length == 0) {
+        result.set_result(rapidjson::kParseErrorDocumentEmpty, 0);
+        return false;
+    }
+
+    snapshot::Region region(data, length);
+    if (length < snapshot::header_size || std::memcmp(data, snapshot::magic, sizeof(snapshot::magic)) != 0
+        || region.read<unsigned>(sizeof(snapshot::magic)) != snapshot::byte_order_mark) {
+        result.set_result(rapidjson::kParseErrorValueInvalid, 0);
+        return false;
+    }
+
+    utility::uint64_t fingerprint = region.read<utility::uint64_t>(8);
+    if (fingerprint != snapshot_fingerprint<ValueType>()) {
+        result.error_stack().push_copy(error::SchemaMismatchError(snapshot_fingerprint<ValueType>(), fingerprint));
+        result.set_result(rapidjson::kParseErrorTermination, 8);
+        return false;
+    }
+
+    view = SnapshotTraits<ValueType>::view(region, snapshot::root_slot);
+    return true;
+}
+}
+
+#endif
@@ -0,0 +1,738 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef AUTOJSONCXX_TAGGED_UNION_HPP_29A4C106C1B1
+#define AUTOJSONCXX_TAGGED_UNION_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/enum_types.hpp>
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace autojsoncxx {
+
+// Generated for every tagged union declared in the definition file:
+//
+//     static const char* type_name();
+//     static const EnumSpelling& discriminator();          // the key, whose token is followed by a colon
+//     static SizeType count();
+//     static const EnumSpelling* tags();                   // in the order of the alternatives
+//     static int find(const char* str, SizeType length);   // the alternative, or -1
+template <class T>
+struct TaggedUnionTraits;
+
+namespace internal {
+
+    // The handler of an alternative behind a virtual interface, so that a union dispatches to any of them
+    class ErasedSAXEventHandlerBase {
+    public:
+        virtual ~ErasedSAXEventHandlerBase() {}
+        virtual bool Null() = 0;
+        virtual bool Bool(bool) = 0;
+        virtual bool Int(int) = 0;
+        virtual bool Uint(unsigned) = 0;
+        virtual bool Int64(utility::int64_t) = 0;
+        virtual bool Uint64(utility::uint64_t) = 0;
+        virtual bool Double(double) = 0;
+        virtual bool String(const char*, SizeType, bool) = 0;
+        virtual bool Key(const char*, SizeType, bool) = 0;
+        virtual bool StartObject() = 0;
+        virtual bool EndObject(SizeType) = 0;
+        virtual bool StartArray() = 0;
+        virtual bool EndArray(SizeType) = 0;
+        virtual bool HasError() const = 0;
+        virtual bool ReapError(error::ErrorStack&) = 0;
+        virtual void PrepareForReuse() = 0;
+    };
+
+    template <class T>
+    class ErasedSAXEventHandler : public ErasedSAXEventHandlerBase {
+    private:
+        SAXEventHandler<T> m_handler;
+
+    public:
+        explicit ErasedSAXEventHandler(T* value)
+            : m_handler(value)
+        {
+        }
+
+        bool Null()
+        {
+            return m_handler.Null();
+        }
+
+        bool Bool(bool b)
+        {
+            return m_handler.Bool(b);
+        }
+
+        bool Int(int i)
+        {
+            return m_handler.Int(i);
+        }
+
+        bool Uint(unsigned i)
+        {
+            return m_handler.Uint(i);
+        }
+
+        bool Int64(utility::int64_t i)
+        {
+            return m_handler.Int64(i);
+        }
+
+        bool Uint64(utility::uint64_t i)
+        {
+            return m_handler.Uint64(i);
+        }
+
+        bool Double(double d)
+        {
+            return m_handler.Double(d);
+        }
+
+        bool String(const char* str, SizeType length, bool copy)
+        {
+            return m_handler.String(str, length, copy);
+        }
+
+        bool Key(const char* str, SizeType length, bool copy)
+        {
+            return m_handler.Key(str, length, copy);
+        }
+
+        bool StartObject()
+        {
+            return m_handler.StartObject();
+        }
+
+        bool EndObject(SizeType length)
+        {
+            return m_handler.EndObject(length);
+        }
+
+        bool StartArray()
+        {
+            return m_handler.StartArray();
+        }
+
+        bool EndArray(SizeType length)
+        {
+            return m_handler.EndArray(length);
+        }
+
+        bool HasError() const
+        {
+            return m_handler.HasError();
+        }
+
+        bool ReapError(error::ErrorStack& errs)
+        {
+            return m_handler.ReapError(errs);
+        }
+
+        void PrepareForReuse()
+        {
+            m_handler.PrepareForReuse();
+        }
+    };
+
+    // The events of an object recorded until its discriminator is seen, then replayed in order.
+    // The memory is kept when cleared, so a reused handler stops allocating.
+    class EventBuffer {
+    private:
+        enum EventKind {
+            kNull,
+            kBool,
+            kInt,
+            kUint,
+            kInt64,
+            kUint64,
+            kDouble,
+            kString,
+            kKey,
+            kStartObject,
+            kEndObject,
+            kStartArray,
+            kEndArray
+        };
+
+        struct Event {
+            EventKind kind;
+            union {
+                bool b;
+                int i;
+                unsigned u;
+                utility::int64_t i64;
+                utility::uint64_t u64;
+                double d;
+                SizeType length;
+            };
+            std::size_t offset;
+        };
+
+        std::vector<Event> m_events;
+        std::string m_text;
+
+        Event& push(EventKind kind)
+        {
+            m_events.push_back(Event());
+            m_events.back().kind = kind;
+            return m_events.back();
+        }
+
+        bool push_text(EventKind kind, const char* str, SizeType length)
+        {
+            Event& e = push(kind);
+            e.offset = m_text.size();
+            e.length = length;
+            m_text.append(str, length);
+            return true;
+        }
+
+    public:
+        bool Null()
+        {
+            push(kNull);
+            return true;
+        }
+
+        bool Bool(bool b)
+        {
+            push(kBool).b = b;
+            return true;
+        }
+
+        bool Int(int i)
+        {
+            push(kInt).i = i;
+            return true;
+        }
+
+        bool Uint(unsigned i)
+        {
+            push(kUint).u = i;
+            return true;
+        }
+
+        bool Int64(utility::int64_t i)
+        {
+            push(kInt64).i64 = i;
+            return true;
+        }
+
+        bool Uint64(utility::uint64_t i)
+        {
+            push(kUint64).u64 = i;
+            return true;
+        }
+
+        bool Double(double d)
+        {
+            push(kDouble).d = d;
+            return true;
+        }
+
+        bool String(const char* str, SizeType length)
+        {
+            return push_text(kString, str, length);
+        }
+
+        bool Key(const char* str, SizeType length)
+        {
+            return push_text(kKey, str, length);
+        }
+
+        bool StartObject()
+        {
+            push(kStartObject);
+            return true;
+        }
+
+        bool EndObject(SizeType length)
+        {
+            push(kEndObject).length = length;
+            return true;
+        }
+
+        bool StartArray()
+        {
+            push(kStartArray);
+            return true;
+        }
+
+        bool EndArray(SizeType length)
+        {
+            push(kEndArray).length = length;
+            return true;
+        }
+
+        void clear()
+        {
+            m_events.clear();
+            m_text.clear();
+        }
+
+        // Stops at the first event the handler rejects
+        template <class Handler>
+        bool replay(Handler& h) const
+        {
+            for (std::size_t i = 0; i < m_events.size(); ++i) {
+                const Event& e = m_events[i];
+                bool success = true;
+                switch (e.kind) {
+                case kNull:
+                    success = h.Null();
+                    break;
+                case kBool:
+                    success = h.Bool(e.b);
+                    break;
+                case kInt:
+                    success = h.Int(e.i);
+                    break;
+                case kUint:
+                    success = h.Uint(e.u);
+                    break;
+                case kInt64:
+                    success = h.Int64(e.i64);
+                    break;
+                case kUint64:
+                    success = h.Uint64(e.u64);
+                    break;
+                case kDouble:
+                    success = h.Double(e.d);
+                    break;
+                case kString:
+                    success = h.String(m_text.data() + e.offset, e.length, true);
+                    break;
+                case kKey:
+                    success = h.Key(m_text.data() + e.offset, e.length, true);
+                    break;
+                case kStartObject:
+                    success = h.StartObject();
+                    break;
+                case kEndObject:
+                    success = h.EndObject(e.length);
+                    break;
+                case kStartArray:
+                    success = h.StartArray();
+                    break;
+                case kEndArray:
+                    success = h.EndArray(e.length);
+                    break;
+                }
+                if (!success)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    // Writes the object of an alternative with the discriminator in front of its members.
+    // Arrays count towards the depth too, so objects nested in arrays are left alone; an alternative
+    // that is not written as an object has nowhere to put the discriminator, and the generator rejects it.
+    template <class Writer>
+    class DiscriminatedWriter {
+    private:
+        Writer& m_writer;
+        const EnumSpelling& m_discriminator;
+        const EnumSpelling& m_tag;
+        int m_depth;
+
+        bool nested() const
+        {
+            assert(m_depth > 0);
+            return m_depth > 0;
+        }
+
+        void write_discriminator()
+        {
+            KeyWriter<Writer>()(m_writer, m_discriminator.name, m_discriminator.length,
+                                m_discriminator.token, m_discriminator.token_length);
+            StringWriter<Writer>()(m_writer, m_tag.name, m_tag.length, m_tag.token, m_tag.token_length);
+        }
+
+    public:
+        explicit DiscriminatedWriter(Writer& w, const EnumSpelling& discriminator, const EnumSpelling& tag)
+            : m_writer(w)
+            , m_discriminator(discriminator)
+            , m_tag(tag)
+            , m_depth(0)
+        {
+        }
+
+        bool Null()
+        {
+            return nested() && m_writer.Null();
+        }
+
+        bool Bool(bool b)
+        {
+            return nested() && m_writer.Bool(b);
+        }
+
+        bool Int(int i)
+        {
+            return nested() && m_writer.Int(i);
+        }
+
+        bool Uint(unsigned i)
+        {
+            return nested() && m_writer.Uint(i);
+        }
+
+        bool Int64(utility::int64_t i)
+        {
+            return nested() && m_writer.Int64(i);
+        }
+
+        bool Uint64(utility::uint64_t i)
+        {
+            return nested() && m_writer.Uint64(i);
+        }
+
+        bool Double(double d)
+        {
+            return nested() && m_writer.Double(d);
+        }
+
+        bool String(const char* str, SizeType length, bool copy = false)
+        {
+            return nested() && m_writer.String(str, length, copy);
+        }
+
+        bool Key(const char* str, SizeType length, bool copy = false)
+        {
+            return m_writer.Key(str, length, copy);
+        }
+
+        bool StringToken(const char* token, SizeType length)
+        {
+            return nested() && m_writer.StringToken(token, length);
+        }
+
+        bool RawNumbers(const char* text, SizeType length, SizeType count)
+        {
+            return nested() && m_writer.RawNumbers(text, length, count);
+        }
+
+        bool StartObject()
+        {
+            bool result = m_writer.StartObject();
+            if (m_depth++ == 0)
+                write_discriminator();
+            return result;
+        }
+
+        bool StartObject(SizeType size)
+        {
+            bool result = m_writer.StartObject(m_depth == 0 ? size + 1 : size);
+            if (m_depth++ == 0)
+                write_discriminator();
+            return result;
+        }
+
+        bool EndObject(SizeType length = 0)
+        {
+            --m_depth;
+            return m_writer.EndObject(m_depth == 0 ? length + 1 : length);
+        }
+
+        bool StartArray()
+        {
+            if (!nested())
+                return false;
+            ++m_depth;
+            return m_writer.StartArray();
+        }
+
+        bool StartArray(SizeType size)
+        {
+            if (!nested())
+                return false;
+            ++m_depth;
+            return m_writer.StartArray(size);
+        }
+
+        bool EndArray(SizeType length = 0)
+        {
+            --m_depth;
+            return m_writer.EndArray(length);
+        }
+    };
+}
+
+namespace utility {
+    namespace traits {
+        // Key tokens are not forwarded, as the first key of the alternative is no longer the first of the object
+        template <class Writer>
+        struct is_canonical_writer<autojsoncxx::internal::DiscriminatedWriter<Writer> >
+            : public is_canonical_writer<Writer> {
+        };
+
+        template <class Writer>
+        struct accepts_raw_numbers<autojsoncxx::internal::DiscriminatedWriter<Writer> >
+            : public accepts_raw_numbers<Writer> {
+        };
+
+        template <class Writer>
+        struct accepts_string_tokens<autojsoncxx::internal::DiscriminatedWriter<Writer> >
+            : public accepts_string_tokens<Writer> {
+        };
+
+        template <class Writer>
+        struct accepts_container_sizes<autojsoncxx::internal::DiscriminatedWriter<Writer> >
+            : public accepts_container_sizes<Writer> {
+        };
+    }
+}
+
+// Writes the alternative of a tagged union
+template <class Writer, class T>
+void write_alternative(Writer& w, const EnumSpelling& discriminator, const EnumSpelling& tag, const T& value)
+{
+    internal::DiscriminatedWriter<Writer> writer(w, discriminator, tag);
+    Serializer<internal::DiscriminatedWriter<Writer>, T>()(writer, value);
+}
+
+// Parses a tagged union, written as the object of one of its alternatives with a discriminator key naming it.
+// The events are buffered only until the discriminator is seen, so when it comes first they go straight
+// to the handler of the alternative. The generated handler provides `alternative(index)`, which sets
+// the tag of the union and returns the handler of that alternative.
+template <class T, class Derived>
+class TaggedUnionSAXEventHandler {
+private:
+    typedef TaggedUnionTraits<T> traits;
+
+    error::ErrorHolder the_error;
+    internal::ErasedSAXEventHandlerBase* m_selected;
+    int m_selected_index;
+    internal::EventBuffer m_buffer;
+    int m_depth;
+
+    // The next event is the value of the discriminator
+    bool m_at_discriminator;
+
+    error::RejectedText m_unknown_tag;
+
+    bool set_type_mismatch(const char* expected_type, const char* actual_type)
+    {
+        the_error.set<error::TypeMismatchError>(expected_type, actual_type);
+        return false;
+    }
+
+    bool check_value(const char* type)
+    {
+        if (m_depth == 0)
+            return set_type_mismatch("object", type);
+        if (m_at_discriminator)
+            return set_type_mismatch("string", type);
+        return true;
+    }
+
+    bool select_alternative(const char* str, SizeType length)
+    {
+        int index = traits::find(str, length);
+        if (index < 0) {
+            the_error.set<error::UnknownAlternativeError>(traits::type_name(), m_unknown_tag.keep(str, length));
+            return false;
+        }
+        m_selected = static_cast<Derived*>(this)->alternative(index);
+        m_selected_index = index;
+        if (!m_selected->StartObject() || !m_buffer.replay(*m_selected))
+            return false;
+        m_buffer.clear();
+        return true;
+    }
+
+    // A repeated discriminator must name the alternative already chosen
+    bool check_repeated_tag(const char* str, SizeType length)
+    {
+        int index = traits::find(str, length);
+        if (index < 0) {
+            the_error.set<error::UnknownAlternativeError>(traits::type_name(), m_unknown_tag.keep(str, length));
+            return false;
+        }
+        if (index != m_selected_index) {
+            const EnumSpelling& discriminator = traits::discriminator();
+            the_error.set<error::DuplicateKeyError>(error::ErrorText(discriminator.name, discriminator.length));
+            return false;
+        }
+        return true;
+    }
+
+protected:
+    explicit TaggedUnionSAXEventHandler()
+        : m_selected(0)
+        , m_selected_index(-1)
+        , m_depth(0)
+        , m_at_discriminator(false)
+    {
+    }
+
+public:
+    bool Null()
+    {
+        if (!check_value("null"))
+            return false;
+        return m_selected ? m_selected->Null() : m_buffer.Null();
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_value("bool"))
+            return false;
+        return m_selected ? m_selected->Bool(b) : m_buffer.Bool(b);
+    }
+
+    bool Int(int i)
+    {
+        if (!check_value("int"))
+            return false;
+        return m_selected ? m_selected->Int(i) : m_buffer.Int(i);
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_value("unsigned"))
+            return false;
+        return m_selected ? m_selected->Uint(i) : m_buffer.Uint(i);
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_value("int64_t"))
+            return false;
+        return m_selected ? m_selected->Int64(i) : m_buffer.Int64(i);
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_value("uint64_t"))
+            return false;
+        return m_selected ? m_selected->Uint64(i) : m_buffer.Uint64(i);
+    }
+
+    bool Double(double d)
+    {
+        if (!check_value("double"))
+            return false;
+        return m_selected ? m_selected->Double(d) : m_buffer.Double(d);
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (m_depth == 0)
+            return set_type_mismatch("object", "string");
+        if (m_at_discriminator) {
+            m_at_discriminator = false;
+
+            return m_selected ? check_repeated_tag(str, length) : select_alternative(str, length);
+        }
+        return m_selected ? m_selected->String(str, length, copy) : m_buffer.String(str, length);
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (m_depth == 1) {
+            const EnumSpelling& discriminator = traits::discriminator();
+            if (utility::string_equal(str, length, discriminator.name, discriminator.length)) {
+                m_at_discriminator = true;
+                return true;
+            }
+        }
+        return m_selected ? m_selected->Key(str, length, copy) : m_buffer.Key(str, length);
+    }
+
+    bool StartObject()
+    {
+        if (m_at_discriminator)
+            return set_type_mismatch("string", "object");
+
+        // The alternative starts its object when it is chosen
+        if (m_depth++ == 0)
+            return true;
+        return m_selected ? m_selected->StartObject() : m_buffer.StartObject();
+    }
+
+    bool EndObject(SizeType length)
+    {
+        if (--m_depth > 0)
+            return m_selected ? m_selected->EndObject(length) : m_buffer.EndObject(length);
+
+        if (!m_selected) {
+            the_error.set<error::RequiredFieldMissingError>();
+            return false;
+        }
+        return m_selected->EndObject(length > 0 ? length - 1 : 0);
+    }
+
+    bool StartArray()
+    {
+        if (!check_value("array"))
+            return false;
+        ++m_depth;
+        return m_selected ? m_selected->StartArray() : m_buffer.StartArray();
+    }
+
+    bool EndArray(SizeType length)
+    {
+        --m_depth;
+        return m_selected ? m_selected->EndArray(length) : m_buffer.EndArray(length);
+    }
+
+    bool HasError() const
+    {
+        return !the_error.empty() || (m_selected && m_selected->HasError());
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (the_error.empty())
+            return m_selected && m_selected->ReapError(errs);
+
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED)
+            static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, traits::discriminator().name);
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        the_error.reset();
+        if (m_selected)
+            m_selected->PrepareForReuse();
+        m_selected = 0;
+        m_selected_index = -1;
+        m_buffer.clear();
+        m_depth = 0;
+        m_at_discriminator = false;
+    }
+};
+}
+
+#endif
@@ -26,36 +26,412 @@
 #include <autojsoncxx/utility.hpp>
 #include <autojsoncxx/base.hpp>
 #include <autojsoncxx/error.hpp>
+#include <autojsoncxx/escape.hpp>
 
 #include <rapidjson/writer.h>
 #include <rapidjson/filewritestream.h>
 #include <rapidjson/prettywriter.h>
 
 #include <cstdio>
+#include <cassert>
+#include <string>
 
 namespace autojsoncxx {
 
+// An output stream that appends directly to a std::string.
+// No intermediate buffer is involved, and the capacity of the string is reused,
+// so serializing repeatedly into the same string does not allocate in the steady state.
+class StringOutputStream {
+private:
+    std::string* m_str;
+
+public:
+    typedef char Ch;
+
+    explicit StringOutputStream(std::string& str)
+        : m_str(&str)
+    {
+    }
+
+    void Put(char c)
+    {
+        m_str->push_back(c);
+    }
+
+    void Flush()
+    {
+    }
+
+    std::string& str() const AUTOJSONCXX_NOEXCEPT
+    {
+        return *m_str;
+    }
+};
+
+inline void put_range(StringOutputStream& os, const char* data, std::size_t length)
+{
+    os.str().append(data, length);
+}
+
+// An output stream that discards everything and only counts the characters.
+// Combined with the regular writers, it measures the exact size of the output
+// because the same escaping and number formatting code runs.
+class CountingOutputStream {
+private:
+    std::size_t m_count;
+
+public:
+    typedef char Ch;
+
+    explicit CountingOutputStream()
+        : m_count(0)
+    {
+    }
+
+    void Put(char)
+    {
+        ++m_count;
+    }
+
+    void Flush()
+    {
+    }
+
+    std::size_t size() const AUTOJSONCXX_NOEXCEPT
+    {
+        return m_count;
+    }
+
+    void Skip(std::size_t length)
+    {
+        m_count += length;
+    }
+};
+
+inline void put_range(CountingOutputStream& os, const char*, std::size_t length)
+{
+    os.Skip(length);
+}
+
+namespace utility {
+    namespace traits {
+        // Whether strings can be written byte for byte, without transcoding
+        template <class SourceEncoding, class TargetEncoding>
+        struct is_plain_utf8 : public false_type {
+        };
+
+        template <>
+        struct is_plain_utf8<rapidjson::UTF8<char>, rapidjson::UTF8<char> > : public true_type {
+        };
+    }
+}
+
+// A `rapidjson::Writer` that also accepts the precomputed key tokens of generated classes.
+// The token is copied verbatim except for its trailing colon, which the normal bookkeeping
+// writes in front of the value, so the structure of the output is still checked.
+template <class OutputStream, class SourceEncoding = rapidjson::UTF8<>,
+          class TargetEncoding = rapidjson::UTF8<>, class StackAllocator = rapidjson::CrtAllocator>
+class KeyTokenWriter : public rapidjson::Writer<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> {
+private:
+    typedef rapidjson::Writer<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> base_type;
+    typedef typename base_type::Level level_type;
+    typedef utility::traits::is_plain_utf8<SourceEncoding, TargetEncoding> plain_utf8;
+
+    bool write_string(const char* str, SizeType length, utility::traits::true_type)
+    {
+        utility::write_escaped_string(*this->os_, str, length);
+        return true;
+    }
+
+    bool write_string(const typename base_type::Ch* str, SizeType length, utility::traits::false_type)
+    {
+        return this->WriteString(str, length);
+    }
+
+public:
+    typedef typename base_type::Ch Ch;
+
+    explicit KeyTokenWriter(OutputStream& os)
+        : base_type(os)
+    {
+    }
+
+    bool String(const Ch* str, SizeType length, bool = false)
+    {
+        this->Prefix(rapidjson::kStringType);
+        return write_string(str, length, plain_utf8());
+    }
+
+    bool Key(const Ch* str, SizeType length, bool copy = false)
+    {
+        return String(str, length, copy);
+    }
+
+    bool KeyToken(const char* token, SizeType length)
+    {
+        level_type* level = this->level_stack_.template Top<level_type>();
+        assert(!level->inArray && level->valueCount % 2 == 0);
+        assert((level->valueCount == 0) == (token[0] != ','));
+
+        put_range(*this->os_, token, length - 1);
+        ++level->valueCount;
+        return true;
+    }
+
+    bool StringToken(const char* token, SizeType length)
+    {
+        this->Prefix(rapidjson::kStringType);
+        put_range(*this->os_, token, length);
+        return true;
+    }
+
+    // Append `count` preformatted numbers separated by commas; more than one only inside an array
+    bool RawNumbers(const char* text, SizeType length, SizeType count)
+    {
+        this->Prefix(rapidjson::kNumberType);
+        if (count > 1) {
+            level_type* level = this->level_stack_.template Top<level_type>();
+            assert(level->inArray);
+            level->valueCount += count - 1;
+        }
+        put_range(*this->os_, text, length);
+        return true;
+    }
+};
+
+namespace utility {
+    namespace traits {
+        template <class OutputStream, class SourceEncoding, class TargetEncoding, class StackAllocator>
+        struct accepts_key_tokens<KeyTokenWriter<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> >
+            : public true_type {
+        };
+
+        template <class OutputStream, class SourceEncoding, class TargetEncoding, class StackAllocator>
+        struct accepts_raw_numbers<KeyTokenWriter<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> >
+            : public true_type {
+        };
+
+        template <class OutputStream, class SourceEncoding, class TargetEncoding, class StackAllocator>
+        struct accepts_string_tokens<KeyTokenWriter<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> >
+            : public true_type {
+        };
+    }
+}
+
+// A writer that trusts the serializers to emit well formed structure, as the generated ones do.
+// Instead of a stack of levels validated on every event, a single flag records whether
+// a comma is due before the next value; key tokens carry their own comma.
+// The output is identical to that of `rapidjson::Writer`, but nothing is checked,
+// and the stream is not flushed automatically at the end of the root value.
+template <class OutputStream, class SourceEncoding = rapidjson::UTF8<>,
+          class TargetEncoding = rapidjson::UTF8<>, class StackAllocator = rapidjson::CrtAllocator>
+class UncheckedWriter : public rapidjson::Writer<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> {
+private:
+    typedef rapidjson::Writer<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> base_type;
+    typedef utility::traits::is_plain_utf8<SourceEncoding, TargetEncoding> plain_utf8;
+
+    bool m_need_comma;
+
+    bool write_string(const char* str, SizeType length, utility::traits::true_type)
+    {
+        utility::write_escaped_string(*this->os_, str, length);
+        return true;
+    }
+
+    bool write_string(const typename base_type::Ch* str, SizeType length, utility::traits::false_type)
+    {
+        return this->WriteString(str, length);
+    }
+
+    void prefix(bool need_comma_after)
+    {
+        if (m_need_comma)
+            this->os_->Put(',');
+        m_need_comma = need_comma_after;
+    }
+
+public:
+    typedef typename base_type::Ch Ch;
+
+    explicit UncheckedWriter(OutputStream& os)
+        : base_type(os)
+        , m_need_comma(false)
+    {
+    }
+
+    bool Null()
+    {
+        prefix(true);
+        return this->WriteNull();
+    }
+
+    bool Bool(bool b)
+    {
+        prefix(true);
+        return this->WriteBool(b);
+    }
+
+    bool Int(int i)
+    {
+        prefix(true);
+        return this->WriteInt(i);
+    }
+
+    bool Uint(unsigned i)
+    {
+        prefix(true);
+        return this->WriteUint(i);
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        prefix(true);
+        return this->WriteInt64(i);
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        prefix(true);
+        return this->WriteUint64(i);
+    }
+
+    bool Double(double d)
+    {
+        prefix(true);
+        return this->WriteDouble(d);
+    }
+
+    bool String(const Ch* str, SizeType length, bool = false)
+    {
+        prefix(true);
+        return write_string(str, length, plain_utf8());
+    }
+
+    bool Key(const Ch* str, SizeType length, bool = false)
+    {
+        prefix(false);
+        write_string(str, length, plain_utf8());
+        this->os_->Put(':');
+        return true;
+    }
+
+    bool KeyToken(const char* token, SizeType length)
+    {
+        put_range(*this->os_, token, length);
+        m_need_comma = false;
+        return true;
+    }
+
+    bool StringToken(const char* token, SizeType length)
+    {
+        prefix(true);
+        put_range(*this->os_, token, length);
+        return true;
+    }
+
+    bool RawNumbers(const char* text, SizeType length, SizeType)
+    {
+        prefix(true);
+        put_range(*this->os_, text, length);
+        return true;
+    }
+
+    bool StartObject()
+    {
+        prefix(false);
+        return this->WriteStartObject();
+    }
+
+    bool EndObject(SizeType = 0)
+    {
+        m_need_comma = true;
+        return this->WriteEndObject();
+    }
+
+    bool StartArray()
+    {
+        prefix(false);
+        return this->WriteStartArray();
+    }
+
+    bool EndArray(SizeType = 0)
+    {
+        m_need_comma = true;
+        return this->WriteEndArray();
+    }
+};
+
+namespace utility {
+    namespace traits {
+        template <class OutputStream, class SourceEncoding, class TargetEncoding, class StackAllocator>
+        struct accepts_key_tokens<UncheckedWriter<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> >
+            : public true_type {
+        };
+
+        template <class OutputStream, class SourceEncoding, class TargetEncoding, class StackAllocator>
+        struct accepts_raw_numbers<UncheckedWriter<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> >
+            : public true_type {
+        };
+
+        template <class OutputStream, class SourceEncoding, class TargetEncoding, class StackAllocator>
+        struct accepts_string_tokens<UncheckedWriter<OutputStream, SourceEncoding, TargetEncoding, StackAllocator> >
+            : public true_type {
+        };
+    }
+}
+
+// Policies selecting the writer used by the `to_json` family of functions
+struct CheckedWriterPolicy {
+    template <class OutputStream>
+    struct writer {
+        typedef KeyTokenWriter<OutputStream> type;
+    };
+};
+
+struct UncheckedWriterPolicy {
+    template <class OutputStream>
+    struct writer {
+        typedef UncheckedWriter<OutputStream> type;
+    };
+};
+
 template <class Writer, class ValueType>
 inline void write_json(Writer& w, const ValueType& v)
 {
     Serializer<Writer, ValueType>()(w, v);
 }
 
+template <class OutputStream, class ValueType, class WriterPolicy>
+inline void to_json(OutputStream& os, const ValueType& v, WriterPolicy)
+{
+    typename WriterPolicy::template writer<OutputStream>::type w(os);
+    write_json(w, v);
+    os.Flush();
+}
+
 template <class OutputStream, class ValueType>
 inline void to_json(OutputStream& os, const ValueType& v)
 {
-    rapidjson::Writer<OutputStream> w(os);
-    write_json(w, v);
+    to_json(os, v, CheckedWriterPolicy());
+}
+
+template <class ValueType, class WriterPolicy>
+inline void to_json_string(std::string& str, const ValueType& v, std::size_t BufferSize, WriterPolicy policy)
+{
+    // Keep the existing capacity of `str` so that it can serve as a reusable buffer
+    str.clear();
+    if (str.capacity() < BufferSize)
+        str.reserve(BufferSize);
+
+    StringOutputStream os(str);
+    to_json(os, v, policy);
 }
 
 template <class ValueType>
 inline void to_json_string(std::string& str, const ValueType& v,
                            std::size_t BufferSize = utility::default_buffer_size)
 {
-    typedef rapidjson::StringBuffer OutputStreamType;
-    OutputStreamType os(0, BufferSize);
-    to_json(os, v);
-    str.assign(os.GetString(), os.GetSize());
+    to_json_string(str, v, BufferSize, CheckedWriterPolicy());
 }
 
 template <class ValueType>
@@ -66,17 +442,32 @@ inline std::string to_json_string(const ValueType& v)
     return str;
 }
 
+// The number of bytes `to_json_string(v)` would produce
 template <class ValueType>
-inline bool to_json_file(std::FILE* fp, const ValueType& v)
+inline std::size_t json_size(const ValueType& v)
+{
+    CountingOutputStream os;
+    to_json(os, v);
+    return os.size();
+}
+
+template <class ValueType, class WriterPolicy>
+inline bool to_json_file(std::FILE* fp, const ValueType& v, WriterPolicy policy)
 {
     char buffer[utility::default_buffer_size];
     rapidjson::FileWriteStream os(fp, buffer, sizeof(buffer));
-    to_json(os, v);
+    to_json(os, v, policy);
     return !std::ferror(fp);
 }
 
 template <class ValueType>
-inline bool to_json_file(const char* file_name, const ValueType& v)
+inline bool to_json_file(std::FILE* fp, const ValueType& v)
+{
+    return to_json_file(fp, v, CheckedWriterPolicy());
+}
+
+template <class ValueType, class WriterPolicy>
+inline bool to_json_file(const char* file_name, const ValueType& v, WriterPolicy policy)
 {
     typedef utility::scoped_ptr<std::FILE, utility::file_closer> guard_type;
 
@@ -85,7 +476,19 @@ inline bool to_json_file(const char* file_name, const ValueType& v)
     if (file_guard.empty())
         return false;
 
-    return to_json_file(file_guard.get(), v);
+    return to_json_file(file_guard.get(), v, policy);
+}
+
+template <class ValueType>
+inline bool to_json_file(const char* file_name, const ValueType& v)
+{
+    return to_json_file(file_name, v, CheckedWriterPolicy());
+}
+
+template <class ValueType, class WriterPolicy>
+inline bool to_json_file(const std::string& file_name, const ValueType& v, WriterPolicy policy)
+{
+    return to_json_file(file_name.c_str(), v, policy);
 }
 
 template <class ValueType>
@@ -94,6 +497,9 @@ inline bool to_json_file(const std::string& file_name, const ValueType& v)
     return to_json_file(file_name.c_str(), v);
 }
 
+// The pretty variants take no writer policy: the policies choose between compact writers,
+// and pretty output is always written by the checked `rapidjson::PrettyWriter`
+
 template <class OutputStream, class ValueType>
 inline void to_pretty_json(OutputStream& os, const ValueType& v)
 {
@@ -105,10 +511,13 @@ template <class ValueType>
 inline void to_pretty_json_string(std::string& str, const ValueType& v,
                                   std::size_t BufferSize = utility::default_buffer_size)
 {
-    typedef rapidjson::StringBuffer OutputStreamType;
-    OutputStreamType os(0, BufferSize);
+    // Keep the existing capacity of `str` so that it can serve as a reusable buffer
+    str.clear();
+    if (str.capacity() < BufferSize)
+        str.reserve(BufferSize);
+
+    StringOutputStream os(str);
     to_pretty_json(os, v);
-    str.assign(os.GetString(), os.GetSize());
 }
 
 template <class ValueType>
@@ -119,6 +528,15 @@ inline std::string to_pretty_json_string(const ValueType& v)
     return str;
 }
 
+// The number of bytes `to_pretty_json_string(v)` would produce
+template <class ValueType>
+inline std::size_t pretty_json_size(const ValueType& v)
+{
+    CountingOutputStream os;
+    to_pretty_json(os, v);
+    return os.size();
+}
+
 template <class ValueType>
 inline bool to_pretty_json_file(std::FILE* fp, const ValueType& v)
 {
@@ -53,9 +53,9 @@ template <class Writer, class... Args>
 struct Serializer<Writer, std::tuple<Args...> > {
     void operator()(Writer& w, const std::tuple<Args...>& t) const
     {
-        w.StartArray();
+        ContainerStarter<Writer>::array(w, sizeof...(Args));
         TupleSerializer<Writer, std::tuple<Args...>, sizeof...(Args)-1>()(w, t);
-        w.EndArray();
+        w.EndArray(sizeof...(Args));
     }
 };
 
@@ -195,8 +195,9 @@ public:
             return static_cast<base_type*>(this)->ReapError(errs);
 
         if (internal_handler.HasError()) {
-            utility::scoped_ptr<error::ErrorBase> guard(new error::ArrayElementError(index));
-            errs.push(guard.release());
+            error::ErrorHolder element_error;
+            element_error.set<error::ArrayElementError>(index);
+            element_error.move_to(errs);
             internal_handler.ReapError(errs);
             return true;
         }
@@ -38,6 +38,12 @@
 #define AUTOJSONCXX_HAS_NOEXCEPT 1
 #define AUTOJSONCXX_HAS_VARIADIC_TEMPLATE 1
 #define AUTOJSONCXX_HAS_EXPLICIT_OPERATOR 1
+#define AUTOJSONCXX_HAS_REGEX 1
+#endif
+
+#if AUTOJSONCXX_MODERN_COMPILER && __cplusplus >= 201703L
+#define AUTOJSONCXX_HAS_OPTIONAL 1
+#define AUTOJSONCXX_HAS_VARIANT 1
 #endif
 
 #if AUTOJSONCXX_HAS_RVALUE
@@ -58,6 +64,10 @@ namespace autojsoncxx {
 namespace utility {
 
     typedef unsigned int SizeType;
+    typedef signed char int8_t;
+    typedef unsigned char uint8_t;
+    typedef short int16_t;
+    typedef unsigned short uint16_t;
     typedef long long int64_t;
     typedef unsigned long long uint64_t;
 
@@ -100,9 +110,103 @@ namespace utility {
         struct is_simple_type<utility::uint64_t> : public true_type {
         };
 
+        template <>
+        struct is_simple_type<utility::int8_t> : public true_type {
+        };
+
+        template <>
+        struct is_simple_type<utility::uint8_t> : public true_type {
+        };
+
+        template <>
+        struct is_simple_type<utility::int16_t> : public true_type {
+        };
+
+        template <>
+        struct is_simple_type<utility::uint16_t> : public true_type {
+        };
+
         template <>
         struct is_simple_type<std::string> : public true_type {
         };
+
+        // Types whose handlers accept only scalar events, and can therefore be parsed in bulk
+        template <class T>
+        struct is_arithmetic_type : public false_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<bool> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<char> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<int> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<unsigned> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<utility::int64_t> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<utility::uint64_t> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<double> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<utility::int8_t> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<utility::uint8_t> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<utility::int16_t> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<utility::uint16_t> : public true_type {
+        };
+
+        template <>
+        struct is_arithmetic_type<float> : public true_type {
+        };
+
+        // Writers whose output must not depend on the iteration order of unordered containers
+        template <class Writer>
+        struct is_canonical_writer : public false_type {
+        };
+
+        // Writers with a `KeyToken()` method that appends a pre-escaped key verbatim
+        template <class Writer>
+        struct accepts_key_tokens : public false_type {
+        };
+
+        // Writers with a `StringToken()` method that appends a pre-escaped, quoted string verbatim
+        template <class Writer>
+        struct accepts_string_tokens : public false_type {
+        };
+
+        // Writers with a `RawNumbers()` method that appends preformatted, comma separated numbers
+        template <class Writer>
+        struct accepts_raw_numbers : public false_type {
+        };
+
+        // Writers with `StartArray(SizeType)` and `StartObject(SizeType)` taking the element count up front
+        template <class Writer>
+        struct accepts_container_sizes : public false_type {
+        };
     }
 
     template <class T>
@@ -0,0 +1,143 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef AUTOJSONCXX_VALIDATION_HPP_29A4C106C1B1
+#define AUTOJSONCXX_VALIDATION_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#if AUTOJSONCXX_HAS_REGEX
+#include <regex>
+#endif
+
+// Helpers called by the generated handlers to check the constraints of the definition file
+namespace autojsoncxx {
+namespace validation {
+
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+
+    // The number of code points, as JSON schema counts the length
+    inline std::size_t string_length(const std::string& str)
+    {
+        std::size_t length = 0;
+        for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+            length += (static_cast<unsigned char>(*it) & 0xC0) != 0x80;
+        return length;
+    }
+
+    namespace internal {
+        template <class Iterator>
+        struct less_by_item {
+            bool operator()(const std::pair<Iterator, std::size_t>& a, const std::pair<Iterator, std::size_t>& b) const
+            {
+                return *a.first < *b.first;
+            }
+        };
+    }
+
+    // The index of the first item equal to an earlier one, or `npos`.
+    // The items are compared with `operator<`.
+    template <class Container>
+    std::size_t find_duplicate(const Container& c)
+    {
+        typedef typename Container::const_iterator iterator;
+        typedef std::pair<iterator, std::size_t> entry;
+
+        std::vector<entry> entries;
+        std::size_t index = 0;
+        for (iterator it = c.begin(); it != c.end(); ++it)
+            entries.push_back(entry(it, index++));
+
+        // Stable, so that equal items stay in the order of their indices
+        internal::less_by_item<iterator> less;
+        std::stable_sort(entries.begin(), entries.end(), less);
+
+        std::size_t result = npos;
+        for (std::size_t i = 1; i < entries.size(); ++i) {
+            if (!less(entries[i - 1], entries[i]) && entries[i].second < result)
+                result = entries[i].second;
+        }
+        return result;
+    }
+
+    // FNV-1a with a seed; the generator computes the same function to build perfect hash tables
+    inline utility::SizeType string_hash(const char* data, std::size_t length, utility::SizeType seed)
+    {
+        utility::SizeType h = 2166136261u ^ seed;
+        for (std::size_t i = 0; i < length; ++i) {
+            h ^= static_cast<unsigned char>(data[i]);
+            h = static_cast<utility::SizeType>(h * 16777619u);
+        }
+        return h;
+    }
+
+    // Looks up a string in a perfect hash table generated from the `enum` option.
+    // Empty slots are null, and the mask is the size of the table minus one.
+    inline bool in_string_set(const char* data, std::size_t length, const char* const* table,
+                              const std::size_t* lengths, utility::SizeType seed, utility::SizeType mask)
+    {
+        utility::SizeType slot = string_hash(data, length, seed) & mask;
+        return table[slot] && lengths[slot] == length && std::memcmp(table[slot], data, length) == 0;
+    }
+
+    inline bool in_string_set(const std::string& str, const char* const* table,
+                              const std::size_t* lengths, utility::SizeType seed, utility::SizeType mask)
+    {
+        return in_string_set(str.data(), str.size(), table, lengths, seed, mask);
+    }
+
+#if AUTOJSONCXX_HAS_REGEX
+
+    // A `pattern` of the definition file, compiled once by the generated handler.
+    // Like JSON schema, the pattern is ECMAScript and not implicitly anchored.
+    class Pattern {
+    private:
+        std::regex m_regex;
+
+        Pattern(const Pattern&);
+        Pattern& operator=(const Pattern&);
+
+    public:
+        explicit Pattern(const char* pattern)
+            : m_regex(pattern, std::regex::ECMAScript | std::regex::optimize)
+        {
+        }
+
+        bool search(const std::string& str) const
+        {
+            return std::regex_search(str, m_regex);
+        }
+    };
+
+#endif
+}
+}
+
+#endif
@@ -0,0 +1,420 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef AUTOJSONCXX_VARIANT_TYPES_HPP_29A4C106C1B1
+#define AUTOJSONCXX_VARIANT_TYPES_HPP_29A4C106C1B1
+
+#include <autojsoncxx/utility.hpp>
+#include <autojsoncxx/base.hpp>
+#include <autojsoncxx/error.hpp>
+#include <autojsoncxx/array_types.hpp>
+#include <autojsoncxx/nullable_types.hpp>
+#include <autojsoncxx/tuple_types.hpp>
+#include <autojsoncxx/map_types.hpp>
+#include <autojsoncxx/enum_types.hpp>
+#include <autojsoncxx/format_types.hpp>
+
+#if AUTOJSONCXX_HAS_VARIANT
+#include <variant>
+#include <type_traits>
+#include <utility>
+
+namespace autojsoncxx {
+
+namespace internal {
+    // The kinds of JSON value, as the bits of a set
+    enum value_kind {
+        null_kind = 1,
+        bool_kind = 2,
+        number_kind = 4,
+        string_kind = 8,
+        object_kind = 16,
+        array_kind = 32
+    };
+
+    // The kinds of JSON value the handler of a type accepts at its start.
+    // The generated classes are objects, unless positional, and the generated enums and formatted types are strings.
+    template <class T>
+    struct value_kinds {
+        static constexpr int value = std::is_base_of<PositionalSAXEventHandler<T>, SAXEventHandler<T> >::value
+            ? array_kind
+            : std::is_base_of<EnumSAXEventHandler<T>, SAXEventHandler<T> >::value
+                    || std::is_base_of<FormattedSAXEventHandler<T, SAXEventHandler<T> >, SAXEventHandler<T> >::value
+                ? string_kind
+                : object_kind;
+    };
+
+    template <>
+    struct value_kinds<std::nullptr_t> : public std::integral_constant<int, null_kind> {
+    };
+
+    template <>
+    struct value_kinds<std::monostate> : public std::integral_constant<int, null_kind> {
+    };
+
+    template <>
+    struct value_kinds<bool> : public std::integral_constant<int, bool_kind> {
+    };
+
+    template <>
+    struct value_kinds<char> : public std::integral_constant<int, bool_kind> {
+    };
+
+    template <>
+    struct value_kinds<int> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<unsigned> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<utility::int8_t> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<utility::uint8_t> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<utility::int16_t> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<utility::uint16_t> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<utility::int64_t> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<utility::uint64_t> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<double> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<float> : public std::integral_constant<int, number_kind> {
+    };
+
+    template <>
+    struct value_kinds<std::string> : public std::integral_constant<int, string_kind> {
+    };
+
+    template <class T, class Allocator>
+    struct value_kinds<std::vector<T, Allocator> >
+        : public std::integral_constant<int, array_kind> {
+    };
+
+    template <class T, class Allocator>
+    struct value_kinds<std::deque<T, Allocator> > : public std::integral_constant<int, array_kind> {
+    };
+
+    template <class T, std::size_t N>
+    struct value_kinds<std::array<T, N> > : public std::integral_constant<int, array_kind> {
+    };
+
+    template <class... Args>
+    struct value_kinds<std::tuple<Args...> > : public std::integral_constant<int, array_kind> {
+    };
+
+    template <class T, class Compare, class Allocator>
+    struct value_kinds<std::map<std::string, T, Compare, Allocator> >
+        : public std::integral_constant<int, object_kind> {
+    };
+
+    template <class T, class Compare, class Allocator>
+    struct value_kinds<std::multimap<std::string, T, Compare, Allocator> >
+        : public std::integral_constant<int, object_kind> {
+    };
+
+    template <class T, class Hash, class Equal, class Allocator>
+    struct value_kinds<std::unordered_map<std::string, T, Hash, Equal, Allocator> >
+        : public std::integral_constant<int, object_kind> {
+    };
+
+    template <class T, class Hash, class Equal, class Allocator>
+    struct value_kinds<std::unordered_multimap<std::string, T, Hash, Equal, Allocator> >
+        : public std::integral_constant<int, object_kind> {
+    };
+
+    template <class T>
+    struct value_kinds<std::shared_ptr<T> >
+        : public std::integral_constant<int, null_kind | value_kinds<T>::value> {
+    };
+
+    template <class T, class Deleter>
+    struct value_kinds<std::unique_ptr<T, Deleter> >
+        : public std::integral_constant<int, null_kind | value_kinds<T>::value> {
+    };
+
+#if AUTOJSONCXX_HAS_OPTIONAL
+    template <class T>
+    struct value_kinds<std::optional<T> >
+        : public std::integral_constant<int, null_kind | value_kinds<T>::value> {
+    };
+#endif
+
+    template <class... Ts>
+    struct value_kinds<std::variant<Ts...> >
+        : public std::integral_constant<int, (value_kinds<Ts>::value | ...)> {
+    };
+}
+
+template <>
+class SAXEventHandler<std::monostate> : public BaseSAXEventHandler<SAXEventHandler<std::monostate> > {
+public:
+    static const char* type_name()
+    {
+        return "null";
+    }
+
+    explicit SAXEventHandler(std::monostate*)
+    {
+    }
+
+    bool Null()
+    {
+        return true;
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, std::monostate> {
+    void operator()(Writer& w, std::monostate) const
+    {
+        w.Null();
+    }
+};
+
+// Chooses the alternative from the first event of a value. A scalar is complete in that one event, so it goes
+// to the first alternative, in order, whose handler accepts it: `1.5` skips an `int` for a `double`, and `300`
+// skips an `unsigned char` for an `int`. An object or array goes to the first alternative accepting that kind
+// of value. The value and the handler of the alternative are both held inline, and every later event goes
+// straight to that handler.
+template <class... Ts>
+class SAXEventHandler<std::variant<Ts...> > {
+private:
+    typedef std::variant<Ts...> variant_type;
+
+    static constexpr int kinds[] = { internal::value_kinds<Ts>::value... };
+
+    variant_type* m_value;
+    std::variant<std::monostate, SAXEventHandler<Ts>...> m_handler;
+    error::ErrorHolder the_error;
+    int m_depth;
+
+    template <std::size_t I>
+    void emplace()
+    {
+        m_handler.template emplace<I + 1>(&m_value->template emplace<I>());
+    }
+
+    template <std::size_t... Is>
+    void emplace_at(std::size_t index, std::index_sequence<Is...>)
+    {
+        static constexpr void (SAXEventHandler::*emplacers[])() = { &SAXEventHandler::emplace<Is>... };
+        (this->*emplacers[index])();
+    }
+
+    bool set_type_mismatch(const char* type)
+    {
+        the_error.set<error::TypeMismatchError>("variant", type);
+        return false;
+    }
+
+    // Chooses the alternative at the start of an object or array at the top level
+    bool start_container(int kind, const char* type)
+    {
+        if (m_depth > 0)
+            return true;
+        for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+            if (kinds[i] & kind) {
+                emplace_at(i, std::index_sequence_for<Ts...>());
+                return true;
+            }
+        }
+        return set_type_mismatch(type);
+    }
+
+    // Gives a scalar at the top level to each alternative accepting its kind, until one accepts the value.
+    // When all of them reject it, the error of the last one is kept.
+    template <class Event>
+    bool scalar(int kind, const char* type, Event event)
+    {
+        if (m_depth > 0)
+            return forward(event);
+
+        bool found = false;
+        for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+            if (kinds[i] & kind) {
+                found = true;
+                emplace_at(i, std::index_sequence_for<Ts...>());
+                if (forward(event))
+                    return true;
+            }
+        }
+        return found ? false : set_type_mismatch(type);
+    }
+
+    template <class Event>
+    bool forward(Event event)
+    {
+        return std::visit(
+            [&event](auto& h) -> bool {
+                if constexpr (std::is_same<std::decay_t<decltype(h)>, std::monostate>::value)
+                    return false;
+                else
+                    return event(h);
+            },
+            m_handler);
+    }
+
+public:
+    explicit SAXEventHandler(variant_type* v)
+        : m_value(v)
+        , m_depth(0)
+    {
+    }
+
+    bool Null()
+    {
+        return scalar(internal::null_kind, "null", [](auto& h) { return h.Null(); });
+    }
+
+    bool Bool(bool b)
+    {
+        return scalar(internal::bool_kind, "bool", [b](auto& h) { return h.Bool(b); });
+    }
+
+    bool Int(int i)
+    {
+        return scalar(internal::number_kind, "int", [i](auto& h) { return h.Int(i); });
+    }
+
+    bool Uint(unsigned i)
+    {
+        return scalar(internal::number_kind, "unsigned", [i](auto& h) { return h.Uint(i); });
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        return scalar(internal::number_kind, "int64_t", [i](auto& h) { return h.Int64(i); });
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        return scalar(internal::number_kind, "uint64_t", [i](auto& h) { return h.Uint64(i); });
+    }
+
+    bool Double(double d)
+    {
+        return scalar(internal::number_kind, "double", [d](auto& h) { return h.Double(d); });
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        return scalar(internal::string_kind, "string", [=](auto& h) { return h.String(str, length, copy); });
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        return forward([=](auto& h) { return h.Key(str, length, copy); });
+    }
+
+    bool StartObject()
+    {
+        if (!start_container(internal::object_kind, "object"))
+            return false;
+        ++m_depth;
+        return forward([](auto& h) { return h.StartObject(); });
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --m_depth;
+        return forward([length](auto& h) { return h.EndObject(length); });
+    }
+
+    bool StartArray()
+    {
+        if (!start_container(internal::array_kind, "array"))
+            return false;
+        ++m_depth;
+        return forward([](auto& h) { return h.StartArray(); });
+    }
+
+    bool EndArray(SizeType length)
+    {
+        --m_depth;
+        return forward([length](auto& h) { return h.EndArray(length); });
+    }
+
+    bool HasError() const
+    {
+        if (!the_error.empty())
+            return true;
+        return std::visit(
+            [](const auto& h) -> bool {
+                if constexpr (std::is_same<std::decay_t<decltype(h)>, std::monostate>::value)
+                    return false;
+                else
+                    return h.HasError();
+            },
+            m_handler);
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (the_error.empty())
+            return forward([&errs](auto& h) { return h.ReapError(errs); });
+        the_error.move_to(errs);
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        the_error.reset();
+        m_handler.template emplace<0>();
+        m_depth = 0;
+    }
+};
+
+template <class Writer, class... Ts>
+struct Serializer<Writer, std::variant<Ts...> > {
+    void operator()(Writer& w, const std::variant<Ts...>& value) const
+    {
+        if (value.valueless_by_exception()) {
+            w.Null();
+            return;
+        }
+        std::visit([&w](const auto& v) { Serializer<Writer, std::decay_t<decltype(v)> >()(w, v); }, value);
+    }
+};
+}
+
+#endif
+#endif
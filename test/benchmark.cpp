@@ -0,0 +1,345 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Rough throughput of the opt-in streams, writers, readers and formats, next to the plain JSON paths.
+// It is built with the tests but not run by them, since the numbers depend on the machine.
+// Run it from the test directory, optionally with the names of the benchmarks to run.
+
+#define AUTOJSONCXX_HAS_MODERN_TYPES 1
+#define AUTOJSONCXX_HAS_RVALUE 1
+#define AUTOJSONCXX_HAS_REGEX 1
+
+#ifndef AUTOJSONCXX_ROOT_DIRECTORY
+#define AUTOJSONCXX_ROOT_DIRECTORY ".."
+#endif
+
+#include "userdef.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef AUTOJSONCXX_ENABLE_POSIX_STREAMS
+#include <unistd.h>
+#endif
+
+using namespace autojsoncxx;
+using namespace config;
+
+namespace {
+
+// The users of the example, repeated into a few megabytes of JSON
+const std::size_t user_copies = 20000;
+
+std::vector<User> load_users()
+{
+    std::vector<User> users;
+    ParsingResult err;
+    if (!from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err)) {
+        std::fprintf(stderr, "%s\n", err.description().c_str());
+        std::exit(EXIT_FAILURE);
+    }
+    std::vector<User> result;
+    result.reserve(users.size() * user_copies);
+    for (std::size_t i = 0; i < user_copies; ++i)
+        result.insert(result.end(), users.begin(), users.end());
+    return result;
+}
+
+// Reports the best of a few runs of `f`, in milliseconds and as megabytes of `bytes` per second
+template <class Function>
+void measure(const char* name, std::size_t bytes, Function f)
+{
+    double best = 0;
+    for (int i = 0; i < 5; ++i) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        f();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || elapsed < best)
+            best = elapsed;
+    }
+    std::printf("    %-40s %9.1f MB/s %10.2f ms\n", name, static_cast<double>(bytes) / best / 1e6, best * 1e3);
+}
+
+// Reports the size of an encoding next to that of the same value as JSON text
+void report_size(const char* name, std::size_t size, std::size_t json_size)
+{
+    std::printf("    %-40s %9.1f MB, %.0f%% of JSON\n", name, static_cast<double>(size) / 1e6,
+                100.0 * static_cast<double>(size) / static_cast<double>(json_size));
+}
+
+// Keeps results that are otherwise unused from being optimized away
+volatile unsigned long long sink;
+
+void fail(const char* name)
+{
+    std::fprintf(stderr, "%s failed\n", name);
+    std::exit(EXIT_FAILURE);
+}
+
+// The baseline of the others: JSON text in memory
+void benchmark_json(const std::vector<User>& users)
+{
+    // Encodes into a reused string, as the entries of the other formats do
+    std::string json = to_json_string(users);
+    std::string output;
+    measure("to_json_string", json.size(), [&] { to_json_string(output, users); });
+    measure("from_json_string", json.size(), [&] {
+        std::vector<User> parsed;
+        ParsingResult err;
+        if (!from_json_string(json, parsed, err))
+            fail("from_json_string");
+    });
+}
+
+#ifdef AUTOJSONCXX_ENABLE_POSIX_STREAMS
+// Writing a file through the small stack buffer of to_json_file, against the large buffer of the
+// file descriptor stream, with and without preallocation, and against a mapping of the known size
+void benchmark_streams(const std::vector<User>& users)
+{
+    std::size_t size = to_json_string(users).size();
+    utility::scoped_ptr<std::FILE, utility::file_closer> file(std::tmpfile());
+    if (file.empty())
+        fail("tmpfile");
+    std::FILE* fp = file.get();
+    int fd = fileno(fp);
+
+    // Every run starts from an empty file
+    auto truncate = [fd] {
+        if (::ftruncate(fd, 0) != 0 || ::lseek(fd, 0, SEEK_SET) != 0)
+            fail("ftruncate");
+    };
+
+    measure("to_json_file (FILE*)", size, [&] {
+        truncate();
+        std::rewind(fp);
+        if (!to_json_file(fp, users) || std::fflush(fp) != 0)
+            fail("to_json_file");
+    });
+    measure("to_json_fd", size, [&] {
+        truncate();
+        if (!to_json_fd(fd, users))
+            fail("to_json_fd");
+    });
+    measure("FileDescriptorWriteStream, Preallocate", size, [&] {
+        truncate();
+        FileDescriptorWriteStream os(fd);
+        os.Preallocate(size);
+        to_json(os, users);
+        os.Flush();
+        if (os.has_error())
+            fail("FileDescriptorWriteStream");
+    });
+    measure("MemoryMappedWriteStream", size, [&] {
+        truncate();
+        MemoryMappedWriteStream os(fd, size);
+        to_json(os, users);
+        if (!os.Close())
+            fail("MemoryMappedWriteStream");
+    });
+}
+
+// Loading the users at startup: parsing a JSON file, against mapping a snapshot and opening it in place,
+// both alone and followed by a read of one member of every user
+void benchmark_snapshot(const std::vector<User>& users)
+{
+    utility::scoped_ptr<std::FILE, utility::file_closer> json_file(std::tmpfile());
+    utility::scoped_ptr<std::FILE, utility::file_closer> snapshot_file(std::tmpfile());
+    if (json_file.empty() || snapshot_file.empty())
+        fail("tmpfile");
+    if (!to_json_file(json_file.get(), users) || std::fflush(json_file.get()) != 0)
+        fail("to_json_file");
+    std::size_t json_size = static_cast<std::size_t>(std::ftell(json_file.get()));
+
+    int fd = fileno(snapshot_file.get());
+    {
+        FileDescriptorWriteStream os(fd);
+        write_snapshot(os, users);
+        os.Flush();
+        if (os.has_error())
+            fail("write_snapshot");
+    }
+    report_size("snapshot", static_cast<std::size_t>(::lseek(fd, 0, SEEK_END)), json_size);
+
+    measure("from_json_file", json_size, [&] {
+        std::rewind(json_file.get());
+        std::vector<User> parsed;
+        ParsingResult err;
+        if (!from_json_file(json_file.get(), parsed, err))
+            fail("from_json_file");
+    });
+    measure("MemoryMappedFile, open_snapshot", json_size, [&] {
+        MemoryMappedFile mapping(fd);
+        snapshot::ListView<User> view;
+        ParsingResult err;
+        if (mapping.has_error() || !open_snapshot<std::vector<User> >(mapping.data(), mapping.size(), view, err))
+            fail("open_snapshot");
+    });
+    measure("open_snapshot, read every ID", json_size, [&] {
+        MemoryMappedFile mapping(fd);
+        snapshot::ListView<User> view;
+        ParsingResult err;
+        if (mapping.has_error() || !open_snapshot<std::vector<User> >(mapping.data(), mapping.size(), view, err))
+            fail("open_snapshot");
+        unsigned long long sum = 0;
+        for (std::size_t i = 0; i < view.size(); ++i)
+            sum += view[i].ID();
+        sink = sum;
+    });
+}
+#endif
+
+// Dumping the block events of the users with the checked rapidjson::Writer and the UncheckedWriter
+void benchmark_writers(const std::vector<User>& users)
+{
+    std::vector<event::BlockEvent> events;
+    for (std::size_t i = 0; i < users.size(); ++i)
+        events.insert(events.end(), users[i].dark_history.begin(), users[i].dark_history.end());
+
+    std::string json;
+    to_json_string(json, events);
+    measure("CheckedWriterPolicy", json.size(), [&] {
+        to_json_string(json, events, utility::default_buffer_size, CheckedWriterPolicy());
+    });
+    measure("UncheckedWriterPolicy", json.size(), [&] {
+        to_json_string(json, events, utility::default_buffer_size, UncheckedWriterPolicy());
+    });
+}
+
+// Encoding and decoding MessagePack. The throughput counts the size of the same value as JSON text,
+// so that it compares with the baseline
+void benchmark_msgpack(const std::vector<User>& users)
+{
+    std::size_t json_size = to_json_string(users).size();
+    std::string packed = to_msgpack_string(users);
+    report_size("MessagePack", packed.size(), json_size);
+
+    measure("to_msgpack_string", json_size, [&] { to_msgpack_string(packed, users); });
+    measure("from_msgpack_string", json_size, [&] {
+        std::vector<User> parsed;
+        ParsingResult err;
+        if (!from_msgpack_string(packed, parsed, err))
+            fail("from_msgpack_string");
+    });
+}
+
+// Encoding and decoding CBOR with definite lengths, counted like MessagePack
+void benchmark_cbor(const std::vector<User>& users)
+{
+    std::size_t json_size = to_json_string(users).size();
+    std::string encoded = to_cbor_string(users);
+    report_size("CBOR", encoded.size(), json_size);
+
+    measure("to_cbor_string", json_size, [&] { to_cbor_string(encoded, users); });
+    measure("from_cbor_string", json_size, [&] {
+        std::vector<User> parsed;
+        ParsingResult err;
+        if (!from_cbor_string(encoded, parsed, err))
+            fail("from_cbor_string");
+    });
+}
+
+#ifdef AUTOJSONCXX_ENABLE_FAST_NUMBERS
+// The exact conversion of rapidjson, whose results the fast path reproduces bit for bit
+struct FullPrecisionReaderPolicy {
+    template <class InputStream, class Handler>
+    static rapidjson::ParseResult parse(InputStream& is, Handler& handler)
+    {
+        rapidjson::Reader reader;
+        return reader.Parse<rapidjson::kParseFullPrecisionFlag>(is, handler);
+    }
+};
+
+// Parsing an array of random coordinates into std::vector<double> with each number parser
+void benchmark_numbers(const std::vector<User>&)
+{
+    std::vector<double> values;
+    std::srand(42);
+    for (int i = 0; i < 1000000; ++i)
+        values.push_back((std::rand() - RAND_MAX / 2) / 1e4 + std::rand() / static_cast<double>(RAND_MAX));
+    std::string json = to_json_string(values);
+
+    // The handler appends, so every run clears the vector but keeps its capacity
+    std::vector<double> parsed;
+    ParsingResult err;
+    measure("DefaultReaderPolicy", json.size(), [&] {
+        parsed.clear();
+        if (!from_json_string(json, parsed, err, DefaultReaderPolicy()))
+            fail("DefaultReaderPolicy");
+    });
+    measure("kParseFullPrecisionFlag", json.size(), [&] {
+        parsed.clear();
+        if (!from_json_string(json, parsed, err, FullPrecisionReaderPolicy()))
+            fail("kParseFullPrecisionFlag");
+    });
+    measure("FastNumberReaderPolicy", json.size(), [&] {
+        parsed.clear();
+        if (!from_json_string(json, parsed, err, FastNumberReaderPolicy()))
+            fail("FastNumberReaderPolicy");
+    });
+}
+#endif
+
+struct Benchmark {
+    const char* name;
+    void (*run)(const std::vector<User>&);
+};
+
+const Benchmark benchmarks[] = {
+    { "json", benchmark_json },
+    { "writers", benchmark_writers },
+#ifdef AUTOJSONCXX_ENABLE_POSIX_STREAMS
+    { "streams", benchmark_streams },
+    { "snapshot", benchmark_snapshot },
+#endif
+#ifdef AUTOJSONCXX_ENABLE_FAST_NUMBERS
+    { "numbers", benchmark_numbers },
+#endif
+    { "msgpack", benchmark_msgpack },
+    { "cbor", benchmark_cbor },
+};
+
+bool is_selected(const char* name, int argc, char** argv)
+{
+    if (argc <= 1)
+        return true;
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], name) == 0)
+            return true;
+    return false;
+}
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<User> users = load_users();
+    for (std::size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); ++i) {
+        if (!is_selected(benchmarks[i].name, argc, argv))
+            continue;
+        std::printf("%s\n", benchmarks[i].name);
+        benchmarks[i].run(users);
+    }
+    return 0;
+}
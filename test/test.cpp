@@ -24,6 +24,12 @@
 
 #define AUTOJSONCXX_HAS_MODERN_TYPES 1
 #define AUTOJSONCXX_HAS_RVALUE 1
+#define AUTOJSONCXX_HAS_REGEX 1
+
+#if __cplusplus >= 201703L
+#define AUTOJSONCXX_HAS_OPTIONAL 1
+#define AUTOJSONCXX_HAS_VARIANT 1
+#endif
 
 // Uncomment the next line if you are adventurous
 // #define AUTOJSONCXX_HAS_VARIADIC_TEMPLATE 1
@@ -34,6 +40,7 @@
 
 #include "userdef.hpp"
 
+#include <cstdio>
 #include <fstream>
 #include <sstream>
 #include <stack>
@@ -268,7 +275,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::TYPE_MISMATCH);
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
         REQUIRE(std::distance(err.begin(), err.end()) == 1);
 
         auto&& e = static_cast<const error::TypeMismatchError&>(*err.begin());
@@ -284,6 +291,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
+#ifndef AUTOJSONCXX_ENABLE_ERROR_CODES
         REQUIRE(std::distance(err.begin(), err.end()) == 5);
 
         auto it = err.begin();
@@ -300,6 +308,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         ++it;
         REQUIRE(it->type() == error::OBJECT_MEMBER);
         REQUIRE(static_cast<const error::ObjectMemberError&>(*it).member_name() == "dark_history");
+#endif
     }
 
     SECTION("Unknown field in strict parsed class Date", "[parsing], [error], [unknown field]")
@@ -308,7 +317,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::UNKNOWN_FIELD);
+        REQUIRE(err.error_stack().innermost_type() == error::UNKNOWN_FIELD);
 
         REQUIRE(static_cast<const error::UnknownFieldError&>(*err.begin()).field_name() == "hour");
     }
@@ -319,7 +328,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::DUPLICATE_KEYS);
+        REQUIRE(err.error_stack().innermost_type() == error::DUPLICATE_KEYS);
 
         REQUIRE(static_cast<const error::DuplicateKeyError&>(*err.begin()).key() == "Auth-Token");
     }
@@ -330,7 +339,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::DUPLICATE_KEYS);
+        REQUIRE(err.error_stack().innermost_type() == error::DUPLICATE_KEYS);
 
         REQUIRE(static_cast<const error::DuplicateKeyError&>(*err.begin()).key() == "ID");
     }
@@ -341,7 +350,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::NUMBER_OUT_OF_RANGE);
+        REQUIRE(err.error_stack().innermost_type() == error::NUMBER_OUT_OF_RANGE);
     }
 
     SECTION("Mismatch between integer and string", "[parsing], [error], [type mismatch]")
@@ -350,7 +359,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::TYPE_MISMATCH);
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
     }
 
     SECTION("Null character in key", "[parsing], [error], [null character]")
@@ -359,7 +368,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::UNKNOWN_FIELD);
+        REQUIRE(err.error_stack().innermost_type() == error::UNKNOWN_FIELD);
     }
 
     SECTION("Array length not match the fixed C++ type", "[parsing], [error], [length mismatch]")
@@ -369,7 +378,49 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::vector<config::User
         REQUIRE(!from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", trinity, err));
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
-        REQUIRE(err.begin()->type() == error::ARRAY_LENGTH_MISMATCH);
+        REQUIRE(err.error_stack().innermost_type() == error::ARRAY_LENGTH_MISMATCH);
+    }
+}
+
+TEST_CASE("Test for vectors of numbers", "[parsing], [array]")
+{
+    ParsingResult err;
+
+    SECTION("Test for valid arrays", "[parsing], [array]")
+    {
+        std::vector<int> integers;
+        REQUIRE(from_json_string("[1, -2, 3]", integers, err));
+        REQUIRE(integers.size() == 3);
+        REQUIRE(integers[1] == -2);
+
+        std::vector<double> doubles;
+        REQUIRE(from_json_string("[1, 2.5, -3e2]", doubles, err));
+        REQUIRE(doubles.size() == 3);
+        REQUIRE(doubles[2] == -300.0);
+
+        std::array<unsigned, 2> pair;
+        REQUIRE(from_json_string("[7, 8]", pair, err));
+        REQUIRE(pair[1] == 8u);
+        REQUIRE(!from_json_string("[7, 8, 9]", pair, err));
+        REQUIRE(err.error_stack().innermost_type() == error::ARRAY_LENGTH_MISMATCH);
+    }
+
+    SECTION("Test for errors in elements", "[parsing], [array], [error]")
+    {
+        std::vector<int> integers;
+        REQUIRE(!from_json_string("[1, 2, 2.5]", integers, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+        REQUIRE((++err.begin())->type() == error::ARRAY_ELEMENT);
+        REQUIRE(static_cast<const error::ArrayElementError&>(*++err.begin()).index() == 2);
+
+        REQUIRE(!from_json_string("[1, [2]]", integers, err));
+        REQUIRE((++err.begin())->type() == error::ARRAY_ELEMENT);
+
+        REQUIRE(!from_json_string("[1, 4294967295]", integers, err));
+        REQUIRE(err.error_stack().innermost_type() == error::NUMBER_OUT_OF_RANGE);
+
+        REQUIRE(!from_json_string("{}", integers, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
     }
 }
 
@@ -384,7 +435,7 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::map<std::string, co
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
 
-        REQUIRE(err.begin()->type() == error::TYPE_MISMATCH);
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
 
         auto&& e = static_cast<const error::TypeMismatchError&>(*err.begin());
         REQUIRE(e.expected_type() == "object");
@@ -397,9 +448,12 @@ TEST_CASE("Test for mismatch between JSON and C++ class std::map<std::string, co
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
         {
-            REQUIRE(err.begin()->type() == error::TYPE_MISMATCH);
+            REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
 
+#ifndef AUTOJSONCXX_ENABLE_ERROR_CODES
             auto&& e = static_cast<const error::TypeMismatchError&>(*err.begin());
+            REQUIRE(e.type() == error::TYPE_MISMATCH);
+#endif
         }
         {
             auto it = ++err.begin();
@@ -424,8 +478,1318 @@ TEST_CASE("Test for writing JSON", "[serialization]")
     REQUIRE(users.size() == 2);
 
     REQUIRE(to_json_string(users) == read_all(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array_compact.json"));
+
+    SECTION("Test for reusing the output string", "[serialization]")
+    {
+        std::string output;
+        to_json_string(output, users);
+        REQUIRE(output == read_all(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array_compact.json"));
+
+        const char* buffer = output.data();
+        std::size_t capacity = output.capacity();
+        to_json_string(output, users);
+        REQUIRE(output == read_all(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array_compact.json"));
+        REQUIRE(output.data() == buffer);
+        REQUIRE(output.capacity() == capacity);
+    }
+
+    SECTION("Test for the unchecked writer", "[serialization]")
+    {
+        std::string output;
+        to_json_string(output, users, utility::default_buffer_size, UncheckedWriterPolicy());
+        REQUIRE(output == read_all(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array_compact.json"));
+
+        std::map<std::string, std::vector<int> > nested;
+        nested["empty"];
+        nested["numbers"].push_back(1);
+        nested["numbers"].push_back(-2);
+        to_json_string(output, nested, utility::default_buffer_size, UncheckedWriterPolicy());
+        REQUIRE(output == to_json_string(nested));
+    }
+
+    SECTION("Test for the vectorized string escaping", "[serialization]")
+    {
+        std::string text;
+        for (int i = 0; i < 256; ++i) {
+            text += "clean run of text long enough for the vector path ";
+            text += static_cast<char>(i);
+        }
+
+        std::vector<std::string> strings;
+        for (std::size_t i = 0; i < 70; ++i)
+            strings.push_back(text.substr(i, i * 7));
+        strings.push_back(text);
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> reference(buffer);
+        Serializer<rapidjson::Writer<rapidjson::StringBuffer>, std::vector<std::string> >()(reference, strings);
+
+        REQUIRE(to_json_string(strings) == buffer.GetString());
+
+        std::string output;
+        to_json_string(output, strings, utility::default_buffer_size, UncheckedWriterPolicy());
+        REQUIRE(output == buffer.GetString());
+    }
+
+    SECTION("Test for members with fixed precision", "[serialization]")
+    {
+        Reading reading;
+        reading.celsius = 21.349;
+        reading.humidity = 0.5;
+        reading.samples.push_back(0.1);
+        reading.samples.push_back(-2.0);
+        reading.samples.push_back(12.5);
+
+        const char* expected = "{\"celsius\":21.3,\"humidity\":0.500,\"samples\":[0.1,-2.0,12.5]}";
+        REQUIRE(to_json_string(reading) == expected);
+
+        std::string output;
+        to_json_string(output, reading, utility::default_buffer_size, UncheckedWriterPolicy());
+        REQUIRE(output == expected);
+
+        Reading parsed;
+        ParsingResult err;
+        REQUIRE(from_json_string(to_pretty_json_string(reading), parsed, err));
+        REQUIRE(parsed.celsius == 21.3);
+        REQUIRE(parsed.humidity == 0.5);
+        REQUIRE(parsed.samples == reading.samples);
+
+        char buffer[utility::max_fixed_double_length];
+        *utility::format_fixed_double(buffer, 2.675, 2, true) = 0;
+        REQUIRE(std::string(buffer) == "2.67");
+        *utility::format_fixed_double(buffer, -0.0004, 3, true) = 0;
+        REQUIRE(std::string(buffer) == "-0.000");
+        *utility::format_fixed_double(buffer, 1.5, 0, false) = 0;
+        REQUIRE(std::string(buffer) == "2.0");
+        *utility::format_fixed_double(buffer, 2.5, 0, true) = 0;
+        REQUIRE(std::string(buffer) == "2");
+        *utility::format_fixed_double(buffer, 0.9999, 3, true) = 0;
+        REQUIRE(std::string(buffer) == "1.000");
+
+        // Too large for the scaled value to fit in 64 bits, yet still with every decimal
+        *utility::format_fixed_double(buffer, 100000000000000.5, 6, true) = 0;
+        REQUIRE(std::string(buffer) == "100000000000000.500000");
+        *utility::format_fixed_double(buffer, 185.25, 17, true) = 0;
+        REQUIRE(std::string(buffer) == "185.25000000000000000");
+        *utility::format_fixed_double(buffer, 1e20, 2, true) = 0;
+        REQUIRE(std::string(buffer) == "100000000000000000000.00");
+        *utility::format_fixed_double(buffer, -1e300, 1, false) = 0;
+        char printed[utility::max_fixed_double_length];
+        std::sprintf(printed, "%.1f", -1e300);
+        REQUIRE(std::string(buffer) == printed);
+        *utility::format_fixed_double(buffer, 1.7976931348623157e308, 17, true) = 0;
+        std::sprintf(printed, "%.17f", 1.7976931348623157e308);
+        REQUIRE(std::string(buffer) == printed);
+
+        // Non-finite values are not fixed point numbers, and reach the writer the same as without a precision
+        const double non_finite[] = { std::numeric_limits<double>::infinity(),
+                                      -std::numeric_limits<double>::infinity(),
+                                      std::numeric_limits<double>::quiet_NaN() };
+        for (std::size_t i = 0; i < sizeof(non_finite) / sizeof(non_finite[0]); ++i) {
+            rapidjson::StringBuffer fixed_buffer, plain_buffer;
+            KeyTokenWriter<rapidjson::StringBuffer> fixed(fixed_buffer);
+            rapidjson::Writer<rapidjson::StringBuffer> plain(plain_buffer);
+            fixed.StartArray();
+            FixedPointSerializer<KeyTokenWriter<rapidjson::StringBuffer>, true>(2, true)(fixed, non_finite[i]);
+            fixed.EndArray();
+            plain.StartArray();
+            plain.Double(non_finite[i]);
+            plain.EndArray();
+            REQUIRE(std::string(fixed_buffer.GetString()) == plain_buffer.GetString());
+        }
+    }
+
+    SECTION("Test for a large array of doubles", "[serialization]")
+    {
+        std::vector<double> values;
+        for (int i = 0; i < 1000; ++i)
+            values.push_back(i / 7.0 - 50);
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> reference(buffer);
+        reference.StartArray();
+        for (std::size_t i = 0; i < values.size(); ++i)
+            reference.Double(values[i]);
+        reference.EndArray();
+
+        REQUIRE(to_json_string(values) == buffer.GetString());
+    }
+
+    SECTION("Test for computing the size of output", "[serialization]")
+    {
+        REQUIRE(json_size(users) == to_json_string(users).size());
+        REQUIRE(pretty_json_size(users) == to_pretty_json_string(users).size());
+    }
+}
+
+TEST_CASE("Test for the type and offset of errors", "[parsing], [error]")
+{
+    Date date;
+    std::vector<Date> dates;
+    ParsingResult err;
+
+    const char* json = "{\"year\": 2015, \"month\": \"May\", \"day\": 1}";
+    REQUIRE(!from_json_string(json, date, err));
+    REQUIRE(err.error_code() == rapidjson::kParseErrorTermination);
+    REQUIRE(err.offset() > std::strlen("{\"year\": 2015, \"month\": "));
+    REQUIRE(err.offset() < std::strlen(json));
+    REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+
+    REQUIRE(!from_json_string("[{\"year\": 2015, \"month\": 5, \"day\": 1}, {\"year\": 2015}]", dates, err));
+    REQUIRE(err.error_stack().innermost_type() == error::MISSING_REQUIRED);
+
+#ifdef AUTOJSONCXX_ENABLE_ERROR_CODES
+    REQUIRE(err.error_stack().size() == 1);
+    REQUIRE(err.begin() == err.end());
+#else
+    REQUIRE(err.error_stack().size() == 2);
+    REQUIRE(err.error_stack().innermost_type() == error::MISSING_REQUIRED);
+
+    // The errors outlive the reader and the handlers, and the arena is reused by every parsing
+    std::string long_key(100, 'k');
+    std::string description;
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(!from_json_string("{\"year\": 1, \"" + long_key + "\": 2}", date, err));
+        REQUIRE(err.error_stack().size() == 1);
+        REQUIRE(static_cast<const error::UnknownFieldError&>(*err.begin()).field_name() == long_key);
+        if (i == 0)
+            description = err.description();
+        REQUIRE(err.description() == description);
+    }
+
+    error::ErrorStack copies;
+    copies.push_copy(*err.begin());
+    err.set_result(rapidjson::ParseResult());
+    REQUIRE(err.error_stack().empty());
+    REQUIRE(static_cast<const error::UnknownFieldError&>(*copies.begin()).field_name() == long_key);
+
+    // The names of missing members can be edited through the reference, and are copied with the error
+    REQUIRE(!from_json_string("{\"year\": 2015}", date, err));
+    const std::vector<std::string>& names
+        = static_cast<const error::RequiredFieldMissingError&>(*err.begin()).missing_members();
+    REQUIRE(names.size() == 2);
+    REQUIRE(names[0] == "month");
+
+    error::RequiredFieldMissingError missing;
+    missing.add_missing_member(copies, "month");
+    missing.add_missing_member(copies, "day");
+    missing.missing_members().push_back(long_key);
+    copies.push_copy(missing);
+    const std::vector<std::string>& copied_names
+        = static_cast<const error::RequiredFieldMissingError&>(*copies.begin()).missing_members();
+    REQUIRE(copied_names.size() == 3);
+    REQUIRE(copied_names[2] == long_key);
+    REQUIRE(copies.begin()->description().find(long_key) != std::string::npos);
+
+    // Errors of other classes without `copy_to` keep their type and description when copied
+    struct CustomError : public error::ErrorBase {
+        error::error_type type() const
+        {
+            return error::CORRUPTED_DOM;
+        }
+        std::string description() const
+        {
+            return "custom";
+        }
+    };
+    copies.push_copy(CustomError());
+    REQUIRE(copies.begin()->type() == error::CORRUPTED_DOM);
+    REQUIRE(copies.begin()->description() == "custom");
+#endif
+}
+
+TEST_CASE("Test for classes with positional encoding","[parsing], [serialization], [positional]")
+{
+    Waypoint waypoint;
+    ParsingResult err;
+
+    SECTION("Test for round trip", "[parsing], [serialization], [positional]")
+    {
+        waypoint.latitude = 51.5;
+        waypoint.longitude = -0.25;
+        waypoint.label = "home";
+        waypoint.arrival.year = 2015;
+        waypoint.tags.push_back(3);
+        waypoint.tags.push_back(7);
+
+        std::string text = to_json_string(waypoint);
+        REQUIRE(text == "[51.5,-0.25,\"home\",{\"year\":2015,\"month\":0,\"day\":0},[3,7]]");
+
+        Waypoint parsed;
+        REQUIRE(from_json_string(text, parsed, err));
+        REQUIRE(parsed.latitude == 51.5);
+        REQUIRE(parsed.longitude == -0.25);
+        REQUIRE(parsed.label == "home");
+        REQUIRE(parsed.arrival.year == 2015);
+        REQUIRE(parsed.tags == waypoint.tags);
+
+        std::vector<Waypoint> route(3, waypoint);
+        std::vector<Waypoint> parsed_route;
+        REQUIRE(from_json_string(to_pretty_json_string(route), parsed_route, err));
+        REQUIRE(parsed_route.size() == 3);
+        REQUIRE(parsed_route[2].tags == waypoint.tags);
+    }
+
+    SECTION("Test for trailing members left out", "[parsing], [positional]")
+    {
+        REQUIRE(from_json_string("[1, 2]", waypoint, err));
+        REQUIRE(waypoint.latitude == 1);
+        REQUIRE(waypoint.longitude == 2);
+        REQUIRE(waypoint.label == "unnamed");
+        REQUIRE(waypoint.tags.empty());
+    }
+
+    SECTION("Test for errors", "[parsing], [positional], [error]")
+    {
+        REQUIRE(!from_json_string("[1]", waypoint, err));
+        REQUIRE(err.error_stack().innermost_type() == error::MISSING_REQUIRED);
+        REQUIRE(static_cast<const error::RequiredFieldMissingError&>(*err.begin()).missing_members().front() == "longitude");
+
+        REQUIRE(!from_json_string("[1, 2, \"a\", {\"year\": 1, \"month\": 2, \"day\": 3}, [], 5]", waypoint, err));
+        REQUIRE(err.error_stack().innermost_type() == error::ARRAY_LENGTH_MISMATCH);
+
+        REQUIRE(!from_json_string("[1, 2, \"a\", {\"year\": 1, \"month\": 2, \"day\": 3}, [1, \"x\"]]", waypoint, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+#ifndef AUTOJSONCXX_ENABLE_ERROR_CODES
+        error::ErrorStack::const_iterator outermost = err.begin();
+        for (error::ErrorStack::const_iterator it = err.begin(); it != err.end(); ++it)
+            outermost = it;
+        REQUIRE(outermost->type() == error::OBJECT_MEMBER);
+        REQUIRE(static_cast<const error::ObjectMemberError&>(*outermost).member_name() == "tags");
+#endif
+
+        REQUIRE(!from_json_string("{\"latitude\": 1, \"longitude\": 2}", waypoint, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+        REQUIRE(static_cast<const error::TypeMismatchError&>(*err.begin()).expected_type() == "array");
+    }
+}
+
+TEST_CASE("Test for constraints on members", "[parsing], [error], [constraints]")
+{
+    Product product;
+    ParsingResult err;
+
+    SECTION("Test for values within the constraints", "[parsing], [constraints]")
+    {
+        REQUIRE(from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"\u00e9t\u00e9\", \"currency\": \"EUR\", "
+                                 "\"price\": 9.5, \"rating\": 4, \"tags\": [\"a\", \"b\"]}",
+                                 product, err));
+        REQUIRE(product.currency == "EUR");
+        REQUIRE(product.rating == 4);
+
+        // The length counts code points rather than bytes
+        std::string title;
+        for (int i = 0; i < 40; ++i)
+            title += "\xc3\xa9";
+        REQUIRE(from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"" + title + "\"}", product, err));
+        REQUIRE(!from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"" + title + "e\"}", product, err));
+        REQUIRE(static_cast<const error::StringLengthError&>(*err.begin()).length() == 41);
+
+        // Absent members are not checked
+        Product partial;
+        REQUIRE(from_json_string("{\"sku\": \"XYZ-0000\", \"title\": \"x\"}", partial, err));
+        REQUIRE(partial.currency == "USD");
+    }
+
+    SECTION("Test for violations", "[parsing], [error], [constraints]")
+    {
+        REQUIRE(!from_json_string("{\"sku\": \"abc-1234\", \"title\": \"x\"}", product, err));
+        REQUIRE(err.error_stack().innermost_type() == error::PATTERN_MISMATCH);
+        REQUIRE(static_cast<const error::PatternMismatchError&>(*err.begin()).member_name() == "sku");
+
+        REQUIRE(!from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"\"}", product, err));
+        REQUIRE(err.error_stack().innermost_type() == error::STRING_LENGTH);
+        REQUIRE(static_cast<const error::StringLengthError&>(*err.begin()).min_length() == 1);
+
+        REQUIRE(!from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"x\", \"currency\": \"EURO\"}", product, err));
+        REQUIRE(err.error_stack().innermost_type() == error::ENUM_MISMATCH);
+        REQUIRE(static_cast<const error::EnumMismatchError&>(*err.begin()).value() == "EURO");
+
+        REQUIRE(!from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"x\", \"rating\": 6}", product, err));
+        REQUIRE(err.error_stack().innermost_type() == error::ENUM_MISMATCH);
+
+        REQUIRE(!from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"x\", \"price\": -1}", product, err));
+        REQUIRE(err.error_stack().innermost_type() == error::VALUE_OUT_OF_BOUNDS);
+        REQUIRE(static_cast<const error::ValueOutOfBoundsError&>(*err.begin()).value() == -1);
+
+        REQUIRE(!from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"x\", \"tags\": [\"1\", \"2\", \"3\", \"4\", \"5\", \"6\"]}", product, err));
+        REQUIRE(err.error_stack().innermost_type() == error::ITEM_COUNT);
+
+        Product tagged;
+        REQUIRE(!from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"x\", \"tags\": [\"b\", \"a\", \"c\", \"a\", \"b\"]}", tagged, err));
+        REQUIRE(err.error_stack().innermost_type() == error::DUPLICATE_ITEMS);
+        REQUIRE(static_cast<const error::DuplicateItemsError&>(*err.begin()).index() == 3);
+
+        // Checked as soon as the value is complete, before the rest of the object is read
+        std::vector<Product> products;
+        REQUIRE(!from_json_string("[{\"sku\": \"ABC-1234\", \"title\": \"\", \"price\": \"free\"}]", products, err));
+        REQUIRE(err.error_stack().innermost_type() == error::STRING_LENGTH);
+    }
+}
+
+TEST_CASE("Test for enums declared in the definition file", "[parsing], [serialization], [enum]")
+{
+    Product product;
+    ParsingResult err;
+
+    REQUIRE(product.availability == InStock);
+    REQUIRE(from_json_string("{\"sku\": \"ABC-1234\", \"title\": \"x\", \"availability\": \"discontinued\"}", product, err));
+    REQUIRE(product.availability == Discontinued);
+
+    std::vector<Availability> values;
+    REQUIRE(from_json_string("[\"Backorder\", \"in-stock\", \"discontinued\"]", values, err));
+    REQUIRE(values.size() == 3);
+    REQUIRE(values[0] == Backorder);
+    REQUIRE(values[1] == InStock);
+    REQUIRE(to_json_string(values) == "[\"Backorder\",\"in-stock\",\"discontinued\"]");
+    REQUIRE(to_pretty_json_string(values).find("\"in-stock\"") != std::string::npos);
+
+    SECTION("Test for unknown values", "[parsing], [error], [enum]")
+    {
+        REQUIRE(!from_json_string("[\"in-stock\", \"In-stock\"]", values, err));
+        REQUIRE(err.error_stack().innermost_type() == error::UNKNOWN_ENUM_VALUE);
+        const error::UnknownEnumValueError& e = static_cast<const error::UnknownEnumValueError&>(*err.begin());
+        REQUIRE(e.value() == "In-stock");
+        REQUIRE(e.enum_name() == "::config::Availability");
+
+        REQUIRE(!from_json_string("[\"in-stoc\"]", values, err));
+        REQUIRE(err.error_stack().innermost_type() == error::UNKNOWN_ENUM_VALUE);
+
+        REQUIRE(!from_json_string("[0]", values, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+    }
+
+    SECTION("Test for values without a spelling", "[parsing], [serialization], [enum]")
+    {
+        // 3 is in the range of the enum, but names no enumerator
+        values.assign(1, static_cast<Availability>(3));
+        values.push_back(Backorder);
+        REQUIRE(to_json_string(values) == "[3,\"Backorder\"]");
+
+        std::vector<Availability> read;
+        REQUIRE(from_json_string(to_json_string(values), read, err));
+        REQUIRE(read == values);
+
+        REQUIRE(!from_json_string("[4294967295]", read, err));
+        REQUIRE(err.error_stack().innermost_type() == error::NUMBER_OUT_OF_RANGE);
+    }
+}
+
+TEST_CASE("Test for tagged unions", "[parsing], [serialization], [union]")
+{
+    std::vector<Shape> shapes;
+    ParsingResult err;
+
+    // The discriminator comes first in one, and after the members in the other
+    bool success = from_json_string("[{\"kind\": \"circle\", \"radius\": 2}, "
+                                    "{\"width\": 3, \"height\": 4.5, \"kind\": \"rect\"}]",
+                                    shapes, err);
+    {
+        CAPTURE(err.description());
+        REQUIRE(success);
+    }
+    REQUIRE(shapes.size() == 2);
+    REQUIRE(shapes[0].tag == Shape::circle_tag);
+    REQUIRE(shapes[0].circle.radius == 2);
+    REQUIRE(shapes[1].tag == Shape::rectangle_tag);
+    REQUIRE(shapes[1].rectangle.width == 3);
+    REQUIRE(shapes[1].rectangle.height == 4.5);
+
+    const std::string json = to_json_string(shapes);
+    REQUIRE(json == "[{\"kind\":\"circle\",\"radius\":2.0},{\"kind\":\"rect\",\"width\":3.0,\"height\":4.5}]");
+    std::vector<Shape> copy;
+    REQUIRE(from_json_string(json, copy, err));
+    REQUIRE(copy.size() == 2);
+    REQUIRE(copy[1].rectangle.height == 4.5);
+
+    // Only the outermost object gets the discriminator, not the objects inside its arrays
+    {
+        std::map<std::string, std::vector<std::map<std::string, int> > > nested;
+        nested["points"].resize(2);
+        nested["points"][1]["x"] = 1;
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> w(buffer);
+        write_alternative(w, TaggedUnionTraits<Shape>::discriminator(), TaggedUnionTraits<Shape>::tags()[0], nested);
+        REQUIRE(std::string(buffer.GetString()) == "{\"kind\":\"circle\",\"points\":[{},{\"x\":1}]}");
+    }
+
+    SECTION("Test for errors in tagged unions", "[parsing], [error], [union]")
+    {
+        REQUIRE(!from_json_string("[{\"radius\": 1, \"kind\": \"square\"}]", shapes, err));
+        REQUIRE(err.error_stack().innermost_type() == error::UNKNOWN_ALTERNATIVE);
+        const error::UnknownAlternativeError& e = static_cast<const error::UnknownAlternativeError&>(*err.begin());
+        REQUIRE(e.tag() == "square");
+        REQUIRE(e.union_name() == "::config::Shape");
+
+        REQUIRE(!from_json_string("[{\"radius\": 1}]", shapes, err));
+        REQUIRE(err.error_stack().innermost_type() == error::MISSING_REQUIRED);
+        REQUIRE(err.description().find("kind") != std::string::npos);
+
+        REQUIRE(!from_json_string("[{\"kind\": 1, \"radius\": 1}]", shapes, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+
+        // The errors of the alternative come from its own handler, including those of the buffered events
+        REQUIRE(!from_json_string("[{\"width\": \"3\", \"kind\": \"rect\"}]", shapes, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+        REQUIRE(!from_json_string("[{\"kind\": \"rect\", \"width\": 3}]", shapes, err));
+        REQUIRE(err.error_stack().innermost_type() == error::MISSING_REQUIRED);
+
+        // A repeated discriminator must name the same alternative
+        REQUIRE(from_json_string("[{\"kind\": \"circle\", \"radius\": 1, \"kind\": \"circle\"}]", shapes, err));
+        REQUIRE(!from_json_string("[{\"kind\": \"rect\", \"width\": 3, \"height\": 4, \"kind\": \"circle\"}]",
+                                  shapes, err));
+        REQUIRE(err.error_stack().innermost_type() == error::DUPLICATE_KEYS);
+        REQUIRE(static_cast<const error::DuplicateKeyError&>(*err.begin()).key() == "kind");
+        REQUIRE(!from_json_string("[{\"width\": 3, \"kind\": \"rect\", \"kind\": \"square\"}]", shapes, err));
+        REQUIRE(err.error_stack().innermost_type() == error::UNKNOWN_ALTERNATIVE);
+    }
+}
+
+TEST_CASE("Test for narrow numeric types", "[parsing], [serialization], [numbers]")
+{
+    Sample sample;
+    ParsingResult err;
+
+    // The generator picks the narrowest integer types for the bounds of the members
+    REQUIRE(sizeof(sample.channel) == 1);
+    REQUIRE(sizeof(sample.offset) == 2);
+
+    bool success = from_json_string(
+        "{\"channel\": 200, \"offset\": -1000, \"value\": 0.1, \"deltas\": [-128, 0, 127]}", sample, err);
+    {
+        CAPTURE(err.description());
+        REQUIRE(success);
+    }
+    REQUIRE(sample.channel == 200);
+    REQUIRE(sample.offset == -1000);
+    REQUIRE(sample.value == 0.1f);
+    REQUIRE(sample.deltas.size() == 3);
+    REQUIRE(sample.deltas[0] == -128);
+    REQUIRE(to_json_string(sample) == "{\"channel\":200,\"offset\":-1000,\"value\":0.1,\"deltas\":[-128,0,127]}");
+
+    Sample decoded;
+    REQUIRE(from_binary_string(to_binary_string(sample), decoded, err));
+    REQUIRE(decoded.channel == 200);
+    REQUIRE(decoded.value == 0.1f);
+    REQUIRE(decoded.deltas == sample.deltas);
+
+    // Floats are written with the fewest decimals that read back the same
+    std::vector<float> floats;
+    REQUIRE(from_json_string("[0, 1.5, -2.75, 0.3, 1e-7, 16777216, 3.4028234e38]", floats, err));
+    const std::string json = to_json_string(floats);
+    REQUIRE(json.substr(0, 20) == "[0.0,1.5,-2.75,0.3,1");
+    std::vector<float> copy;
+    REQUIRE(from_json_string(json, copy, err));
+    REQUIRE(copy == floats);
+
+    // Infinities and NaN, which binary formats can carry, are kept by floats the same as by doubles
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+        float f = 0;
+        SAXEventHandler<float> handler(&f);
+        REQUIRE(handler.Double(-infinity));
+        REQUIRE(f == -std::numeric_limits<float>::infinity());
+        REQUIRE(handler.Double(std::numeric_limits<double>::quiet_NaN()));
+        REQUIRE(f != f);
+
+        rapidjson::StringBuffer float_buffer, plain_buffer;
+        KeyTokenWriter<rapidjson::StringBuffer> float_writer(float_buffer);
+        rapidjson::Writer<rapidjson::StringBuffer> plain(plain_buffer);
+        float_writer.StartArray();
+        Serializer<KeyTokenWriter<rapidjson::StringBuffer>, float>()(float_writer, std::numeric_limits<float>::infinity());
+        Serializer<KeyTokenWriter<rapidjson::StringBuffer>, float>()(float_writer, f);
+        float_writer.EndArray();
+        plain.StartArray();
+        plain.Double(infinity);
+        plain.Double(std::numeric_limits<double>::quiet_NaN());
+        plain.EndArray();
+        REQUIRE(std::string(float_buffer.GetString()) == plain_buffer.GetString());
+    }
+
+    SECTION("Test for values out of range", "[parsing], [error], [numbers]")
+    {
+        REQUIRE(!from_json_string("[127, 128]", sample.deltas, err));
+        REQUIRE(err.error_stack().innermost_type() == error::NUMBER_OUT_OF_RANGE);
+        REQUIRE((++err.begin())->type() == error::ARRAY_ELEMENT);
+
+        REQUIRE(!from_json_string("{\"channel\": 256, \"value\": 1}", sample, err));
+        REQUIRE(err.error_stack().innermost_type() == error::NUMBER_OUT_OF_RANGE);
+
+        // Within the range of the type, but not of the bounds
+        REQUIRE(!from_json_string("{\"channel\": 1, \"offset\": 1001, \"value\": 1}", sample, err));
+        REQUIRE(err.error_stack().innermost_type() == error::VALUE_OUT_OF_BOUNDS);
+
+        REQUIRE(!from_json_string("[1e39]", floats, err));
+        REQUIRE(err.error_stack().innermost_type() == error::NUMBER_OUT_OF_RANGE);
+        REQUIRE(!from_json_string("[16777217]", floats, err));
+        REQUIRE(err.error_stack().innermost_type() == error::NUMBER_OUT_OF_RANGE);
+    }
+}
+
+TEST_CASE("Test for members with a string format", "[parsing], [serialization], [format]")
+{
+    Device device;
+    ParsingResult err;
+
+    bool success = from_json_string("{\"id\": \"123E4567-e89b-12d3-a456-426614174000\", \"address\": \"192.168.0.1\", "
+                                    "\"gateway\": \"2001:DB8:0:0:0::1\", \"last_seen\": \"1996-12-19T16:39:57.25-08:00\", "
+                                    "\"contact\": \"someone@example.com\"}",
+                                    device,
+                                    err);
+    {
+        CAPTURE(err.description());
+        REQUIRE(success);
+    }
+    REQUIRE(sizeof(device.id) == 16);
+    REQUIRE(device.id.bytes[0] == 0x12);
+    REQUIRE(device.id.bytes[15] == 0x00);
+    REQUIRE(device.address.bytes[0] == 192);
+    REQUIRE(device.address.bytes[3] == 1);
+    REQUIRE(device.gateway.bytes[3] == 0xb8);
+    REQUIRE(device.gateway.bytes[15] == 1);
+    REQUIRE(std::chrono::duration_cast<std::chrono::milliseconds>(device.last_seen.time_since_epoch()).count()
+            == 851042397250LL);
+
+    // Written back in the canonical forms, and in UTC
+    REQUIRE(to_json_string(device) == "{\"id\":\"123e4567-e89b-12d3-a456-426614174000\",\"address\":\"192.168.0.1\","
+                                      "\"gateway\":\"2001:db8::1\",\"last_seen\":\"1996-12-20T00:39:57.25Z\","
+                                      "\"contact\":\"someone@example.com\",\"firmware\":\"\"}");
+
+    Device decoded;
+    REQUIRE(from_binary_string(to_binary_string(device), decoded, err));
+    REQUIRE(decoded.id == device.id);
+    REQUIRE(decoded.gateway == device.gateway);
+    REQUIRE(decoded.last_seen == device.last_seen);
+
+    std::vector<ipv6_address> addresses;
+    REQUIRE(from_json_string("[\"::\", \"::1\", \"1::\", \"::ffff:10.0.0.1\", \"1:0:0:2:0:0:0:3\", \"1:2:3:4:5:6:7:8\"]",
+                             addresses,
+                             err));
+    REQUIRE(to_json_string(addresses) == "[\"::\",\"::1\",\"1::\",\"::ffff:10.0.0.1\",\"1:0:0:2::3\",\"1:2:3:4:5:6:7:8\"]");
+
+    SECTION("Test for strings not matching the format", "[parsing], [error], [format]")
+    {
+        std::vector<ipv4_address> ipv4_addresses;
+        REQUIRE(!from_json_string("[\"01.2.3.4\"]", ipv4_addresses, err));
+        REQUIRE(err.error_stack().innermost_type() == error::FORMAT_MISMATCH);
+        REQUIRE(err.description().find("\"01.2.3.4\" is not a valid ipv4") != std::string::npos);
+
+        const char* invalid_ipv6[] = { "1:2:3:4:5:6:7:8:9", "1::2::3", ":1::", "1:2:3:4:5:6:7::8", "12345::", "::g" };
+        for (std::size_t i = 0; i < sizeof(invalid_ipv6) / sizeof(invalid_ipv6[0]); ++i) {
+            CAPTURE(invalid_ipv6[i]);
+            REQUIRE(!from_json_string("\"" + std::string(invalid_ipv6[i]) + "\"", addresses, err));
+        }
+
+        REQUIRE(!from_json_string("{\"id\": \"123e4567-e89b-12d3-a456-42661417400g\", \"address\": \"1.1.1.1\"}",
+                                  device,
+                                  err));
+        REQUIRE(err.error_stack().innermost_type() == error::FORMAT_MISMATCH);
+
+        REQUIRE(!from_json_string("{\"id\": \"123e4567-e89b-12d3-a456-426614174000\", \"address\": \"1.1.1.1\", "
+                                  "\"last_seen\": \"2015-02-29T00:00:00Z\"}",
+                                  device,
+                                  err));
+        REQUIRE(err.error_stack().innermost_type() == error::FORMAT_MISMATCH);
+    }
+}
+
+TEST_CASE("Test for base64 encoded bytes", "[parsing], [serialization], [format]")
+{
+    ParsingResult err;
+
+    // The vectors of RFC 4648
+    std::vector<bytes> blobs;
+    REQUIRE(from_json_string("[\"\", \"Zg==\", \"Zm8=\", \"Zm9v\", \"Zm9vYg==\", \"Zm9vYmE=\", \"Zm9vYmFy\"]", blobs, err));
+    REQUIRE(blobs.size() == 7);
+    REQUIRE(blobs[0].empty());
+    REQUIRE(std::string(blobs[6].begin(), blobs[6].end()) == "foobar");
+    REQUIRE(std::string(blobs[5].begin(), blobs[5].end()) == "fooba");
+    REQUIRE(to_json_string(blobs) == "[\"\",\"Zg==\",\"Zm8=\",\"Zm9v\",\"Zm9vYg==\",\"Zm9vYmE=\",\"Zm9vYmFy\"]");
+
+    // Every byte value, and larger than the buffer on the stack
+    Device device;
+    for (int i = 0; i < 1000; ++i)
+        device.firmware.push_back(static_cast<unsigned char>(i * 7));
+    Device copy;
+    REQUIRE(from_json_string(to_json_string(device), copy, err));
+    REQUIRE(copy.firmware == device.firmware);
+    REQUIRE(from_binary_string(to_binary_string(device), copy, err));
+    REQUIRE(copy.firmware == device.firmware);
+
+    // Every length around the blocks of the vector paths, against a plain encoder
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (std::size_t size = 0; size < 100; ++size) {
+        bytes data(device.firmware.begin(), device.firmware.begin() + size);
+        std::string encoded(utility::base64_length(size), 0);
+        if (size > 0)
+            utility::encode_base64(&encoded[0], &data[0], size);
+
+        std::string expected;
+        for (std::size_t i = 0; i < size; i += 3) {
+            std::size_t n = size - i < 3 ? size - i : 3;
+            unsigned group = data[i] << 16 | (n > 1 ? data[i + 1] << 8 : 0) | (n > 2 ? data[i + 2] : 0);
+            for (std::size_t k = 0; k < 4; ++k)
+                expected += k <= n ? alphabet[(group >> (18 - 6 * k)) & 63] : '=';
+        }
+        CAPTURE(size);
+        REQUIRE(encoded == expected);
+
+        bytes decoded;
+        REQUIRE(from_json_string("\"" + encoded + "\"", decoded, err));
+        REQUIRE(decoded == data);
+
+        // A character outside the alphabet anywhere, including inside a vector block
+        if (size >= 3) {
+            std::string corrupted = encoded;
+            corrupted[size % corrupted.size()] = '.';
+            REQUIRE(!from_json_string("\"" + corrupted + "\"", decoded, err));
+        }
+    }
+
+    SECTION("Test for invalid base64", "[parsing], [error], [format]")
+    {
+        const char* invalid[] = { "Zg", "Zg=", "Z===", "Zm9v!A==", "Zg==Zg==", "Zm9v\\n" };
+        for (std::size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+            CAPTURE(invalid[i]);
+            REQUIRE(!from_json_string("[\"" + std::string(invalid[i]) + "\"]", blobs, err));
+            REQUIRE(err.error_stack().innermost_type() == error::FORMAT_MISMATCH);
+        }
+    }
+}
+
+#if AUTOJSONCXX_HAS_OPTIONAL && AUTOJSONCXX_HAS_VARIANT
+
+TEST_CASE("Test for std::optional and std::variant", "[parsing], [serialization], [optional], [variant]")
+{
+    ParsingResult err;
+
+    std::vector<std::optional<Date> > dates;
+    REQUIRE(from_json_string("[null, {\"year\": 2000, \"month\": 1, \"day\": 1}]", dates, err));
+    REQUIRE(dates.size() == 2);
+    REQUIRE(!dates[0]);
+    REQUIRE(dates[1]->year == 2000);
+    REQUIRE(to_json_string(dates) == "[null,{\"year\":2000,\"month\":1,\"day\":1}]");
+
+    typedef std::variant<std::monostate, bool, int, std::string, std::vector<int>, Date, Availability> Value;
+    std::vector<Value> values;
+    REQUIRE(from_json_string("[null, true, 3, \"x\", [1, 2], {\"year\": 1970, \"month\": 1, \"day\": 1}]",
+                             values, err));
+    REQUIRE(values.size() == 6);
+    REQUIRE(values[0].index() == 0);
+    REQUIRE(std::get<bool>(values[1]));
+    REQUIRE(std::get<int>(values[2]) == 3);
+
+    // The first alternative accepting a string wins, even over an enum spelling
+    REQUIRE(std::get<std::string>(values[3]) == "x");
+    REQUIRE(std::get<std::vector<int> >(values[4]).size() == 2);
+    REQUIRE(std::get<Date>(values[5]).year == 1970);
+    REQUIRE(to_json_string(values) == "[null,true,3,\"x\",[1,2],{\"year\":1970,\"month\":1,\"day\":1}]");
+
+    std::variant<Availability, double> number_or_enum;
+    REQUIRE(from_json_string("\"in-stock\"", number_or_enum, err));
+    REQUIRE(std::get<Availability>(number_or_enum) == InStock);
+    REQUIRE(from_json_string("2.5", number_or_enum, err));
+    REQUIRE(std::get<double>(number_or_enum) == 2.5);
+
+    // A number goes to the first alternative that holds it
+    std::variant<int, double> int_or_double;
+    REQUIRE(from_json_string("1.5", int_or_double, err));
+    REQUIRE(std::get<double>(int_or_double) == 1.5);
+    REQUIRE(from_json_string("2", int_or_double, err));
+    REQUIRE(std::get<int>(int_or_double) == 2);
+
+    std::variant<unsigned char, int> byte_or_int;
+    REQUIRE(from_json_string("300", byte_or_int, err));
+    REQUIRE(std::get<int>(byte_or_int) == 300);
+    REQUIRE(from_json_string("200", byte_or_int, err));
+    REQUIRE(std::get<unsigned char>(byte_or_int) == 200);
+
+    SECTION("Test for errors in variants", "[parsing], [error], [variant]")
+    {
+        REQUIRE(!from_json_string("[1, 1.5]", values, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+
+        REQUIRE(!from_json_string("{}", number_or_enum, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+
+        REQUIRE(!from_json_string("[{\"year\": 1970}]", values, err));
+        REQUIRE(err.error_stack().innermost_type() == error::MISSING_REQUIRED);
+    }
 }
 
+#endif
+
+#ifdef AUTOJSONCXX_ENABLE_POSIX_STREAMS
+
+TEST_CASE("Test for writing JSON to file descriptors", "[serialization], [posix]")
+{
+    std::vector<User> users;
+    ParsingResult err;
+
+    bool success = from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err);
+    {
+        CAPTURE(err.description());
+        REQUIRE(success);
+    }
+
+    const std::string expected = read_all(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array_compact.json");
+
+    utility::scoped_ptr<std::FILE, utility::file_closer> file(std::tmpfile());
+    REQUIRE(!file.empty());
+    int fd = fileno(file.get());
+
+    SECTION("Test for the buffered stream", "[serialization], [posix]")
+    {
+        // A tiny buffer forces many flushes in the middle of the output
+        REQUIRE(to_json_fd(fd, users, 7));
+    }
+
+    SECTION("Test for the buffered stream with the unchecked writer", "[serialization], [posix]")
+    {
+        REQUIRE(to_json_fd(fd, users, 7, UncheckedWriterPolicy()));
+    }
+
+    SECTION("Test for the memory mapped stream", "[serialization], [posix]")
+    {
+        MemoryMappedWriteStream os(fd, expected.size() + 100);
+        to_json(os, users);
+        REQUIRE(os.Close());
+        REQUIRE(os.size() == expected.size());
+    }
+
+    std::string actual(expected.size() + 1, '\0');
+    REQUIRE(::pread(fd, &actual[0], actual.size(), 0) == static_cast<ssize_t>(expected.size()));
+    actual.resize(expected.size());
+    REQUIRE(actual == expected);
+}
+
+TEST_CASE("Test for failures of the memory mapped stream", "[serialization], [posix]")
+{
+    // A shared writable mapping needs a file opened for reading too, so mapping a write-only one fails
+    char name[] = "/tmp/autojsoncxx_test_XXXXXX";
+    int rw = ::mkstemp(name);
+    REQUIRE(rw >= 0);
+    int fd = ::open(name, O_WRONLY);
+    ::unlink(name);
+    ::close(rw);
+    REQUIRE(fd >= 0);
+
+    {
+        MemoryMappedWriteStream os(fd, 100);
+        REQUIRE(os.has_error());
+        to_json(os, std::vector<int>(10, 1));
+        REQUIRE(os.size() == 0);
+        REQUIRE(!os.Close());
+    }
+    ::close(fd);
+
+    // Writing after `Close()` is an error, not a write through the released mapping
+    utility::scoped_ptr<std::FILE, utility::file_closer> file(std::tmpfile());
+    REQUIRE(!file.empty());
+    MemoryMappedWriteStream os(fileno(file.get()), 100);
+    os.Put('1');
+    REQUIRE(os.Close());
+    os.Put('2');
+    os.Write("34", 2);
+    REQUIRE(os.size() == 1);
+    REQUIRE(os.has_error());
+}
+
+TEST_CASE("Test for memory mapped snapshots", "[snapshot], [posix]")
+{
+    std::map<std::string, Date> dates;
+    dates["epoch"] = create_date(1970, 1, 1);
+    dates["millennium"] = create_date(2000, 1, 1);
+
+    utility::scoped_ptr<std::FILE, utility::file_closer> file(std::tmpfile());
+    REQUIRE(!file.empty());
+    int fd = fileno(file.get());
+
+    FileDescriptorWriteStream os(fd, 64);
+    write_snapshot(os, dates);
+    REQUIRE(!os.has_error());
+
+    MemoryMappedFile mapping(fd);
+    REQUIRE(!mapping.has_error());
+
+    ParsingResult err;
+    snapshot::MapView<Date> view;
+    REQUIRE(open_snapshot<std::map<std::string, Date> >(mapping.data(), mapping.size(), view, err));
+    REQUIRE(view.size() == 2);
+    REQUIRE(view.key(0) == "epoch");
+    REQUIRE(view.value(view.find("millennium")).year() == 2000);
+}
+
+#endif
+
+TEST_CASE("Test for fingerprints of values", "[serialization], [fingerprint]")
+{
+    SECTION("Test for the hash function", "[fingerprint]")
+    {
+        const char text[] = "The quick brown fox jumps over the lazy dog, again and again.";
+
+        utility::XXHash64 hasher;
+        REQUIRE(hasher.digest() == 0xEF46DB3751D8E999ULL);
+
+        hasher.update("abc", 3);
+        REQUIRE(hasher.digest() == 0x44BC2CF5AD770999ULL);
+
+        hasher.reset();
+        hasher.update(text, sizeof(text) - 1);
+        REQUIRE(hasher.digest() == 0x0D5855A4D152A2D5ULL);
+    }
+
+    SECTION("Test for hashing the serialized text", "[fingerprint]")
+    {
+        std::vector<User> users;
+        ParsingResult err;
+
+        bool success = from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+
+        std::string text = to_json_string(users);
+        utility::XXHash64 hasher;
+        hasher.update(text.data(), text.size());
+        REQUIRE(json_fingerprint(users) == hasher.digest());
+    }
+
+    SECTION("Test for canonical order of unordered maps", "[fingerprint]")
+    {
+        std::unordered_map<std::string, int> m1, m2;
+        m2.rehash(1024);
+        for (int i = 0; i < 100; ++i) {
+            std::ostringstream key;
+            key << "key" << i;
+            m1[key.str()] = i;
+            m2[key.str()] = i;
+        }
+        REQUIRE(json_fingerprint(m1) == json_fingerprint(m2));
+
+        std::map<std::string, int> ordered(m1.begin(), m1.end());
+        REQUIRE(json_fingerprint(m1) == json_fingerprint(ordered));
+
+        m2["key0"] = -1;
+        REQUIRE(json_fingerprint(m1) != json_fingerprint(m2));
+
+        // Values sharing a key are ordered by their JSON text, whatever order they were inserted in
+        std::unordered_multimap<std::string, std::vector<int> > mm1, mm2;
+        for (int i = 0, j = 19; i < 20; ++i, --j) {
+            mm1.insert(std::make_pair(std::string(i % 2 ? "odd" : "even"), std::vector<int>(1, i)));
+            mm2.insert(std::make_pair(std::string(j % 2 ? "odd" : "even"), std::vector<int>(1, j)));
+        }
+        REQUIRE(json_fingerprint(mm1) == json_fingerprint(mm2));
+        mm2.insert(std::make_pair(std::string("odd"), std::vector<int>()));
+        REQUIRE(json_fingerprint(mm1) != json_fingerprint(mm2));
+    }
+}
+
+TEST_CASE("Test for MessagePack", "[msgpack]")
+{
+    ParsingResult err;
+
+    SECTION("Test for round trip of generated classes", "[msgpack]")
+    {
+        std::vector<User> users;
+        bool success = from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+
+        std::string packed = to_msgpack_string(users);
+        REQUIRE(packed.size() < to_json_string(users).size());
+
+        std::vector<User> unpacked;
+        success = from_msgpack_string(packed, unpacked, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+        REQUIRE(to_json_string(unpacked) == to_json_string(users));
+    }
+
+    SECTION("Test for the encoding", "[msgpack]")
+    {
+        std::vector<int> numbers;
+        numbers.push_back(1);
+        numbers.push_back(-1);
+        numbers.push_back(200);
+        numbers.push_back(-200);
+        numbers.push_back(70000);
+        REQUIRE(to_msgpack_string(numbers) == std::string("\x95\x01\xff\xcc\xc8\xd1\xff\x38\xce\x00\x01\x11\x70", 13));
+
+        std::map<std::string, std::vector<int> > nested;
+        nested["a"].assign(20, 0);
+        REQUIRE(to_msgpack_string(nested) == std::string("\x81\xa1" "a" "\xdc\x00\x14", 6) + std::string(20, '\0'));
+
+        std::map<std::string, std::vector<int> > parsed;
+        REQUIRE(from_msgpack_string(to_msgpack_string(nested), parsed, err));
+        REQUIRE(parsed == nested);
+    }
+
+    SECTION("Test for malformed input", "[msgpack], [error]")
+    {
+        std::vector<int> numbers;
+        REQUIRE(!from_msgpack_string(std::string("\x92\x01", 2), numbers, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+
+        REQUIRE(!from_msgpack_string(std::string("\x91\x01\x01", 3), numbers, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorDocumentRootNotSingular);
+
+        REQUIRE(!from_msgpack_string(std::string("\x91\xa1x", 3), numbers, err));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+
+        std::map<std::string, int> mapping;
+        REQUIRE(!from_msgpack_string(std::string("\x81\x01\x01", 3), mapping, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorObjectMissName);
+    }
+}
+
+TEST_CASE("Test for CBOR", "[cbor]")
+{
+    ParsingResult err;
+
+    SECTION("Test for round trip of generated classes", "[cbor]")
+    {
+        std::vector<User> users;
+        bool success = from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+
+        std::string encoded = to_cbor_string(users);
+        REQUIRE(encoded.size() < to_json_string(users).size());
+        REQUIRE(static_cast<unsigned char>(encoded[0]) == (0x80 | users.size()));
+        REQUIRE(static_cast<unsigned char>(encoded[1]) == 0xa6);
+
+        std::vector<User> decoded;
+        success = from_cbor_string(encoded, decoded, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+        REQUIRE(to_json_string(decoded) == to_json_string(users));
+    }
+
+    SECTION("Test for the encoding", "[cbor]")
+    {
+        std::vector<std::vector<int> > nested(3);
+        nested[0].push_back(1);
+        nested[1].push_back(2);
+        nested[1].push_back(3);
+        nested[2].push_back(-1);
+        nested[2].push_back(-1000);
+        REQUIRE(to_cbor_string(nested) == std::string("\x83\x81\x01\x82\x02\x03\x82\x20\x39\x03\xe7", 11));
+
+        std::vector<double> numbers;
+        numbers.push_back(1.5);
+        numbers.push_back(100000.0);
+        numbers.push_back(1.1);
+        numbers.push_back(5.960464477539063e-8);
+        REQUIRE(to_cbor_string(numbers) == std::string("\x84\xf9\x3e\x00\xfa\x47\xc3\x50\x00"
+                                                       "\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a\xf9\x00\x01",
+                                                       21));
+
+        std::vector<double> parsed;
+        REQUIRE(from_cbor_string(to_cbor_string(numbers), parsed, err));
+        REQUIRE(parsed == numbers);
+
+        std::map<std::string, std::vector<int> > mapping;
+        mapping["a"].assign(30, 7);
+        std::string encoded = to_cbor_string(mapping);
+        REQUIRE(encoded.substr(0, 5) == std::string("\xa1\x61" "a" "\x98\x1e", 5));
+    }
+
+    SECTION("Test for indefinite lengths, tags and byte strings", "[cbor]")
+    {
+        std::vector<std::vector<int> > nested;
+        REQUIRE(from_cbor_string(std::string("\x9f\x01\x82\x02\x03\x9f\x04\x05\xff\xff", 10), nested, err) == false);
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+
+        REQUIRE(from_cbor_string(std::string("\x9f\x81\x01\x82\x02\x03\x9f\x04\x05\xff\xff", 11), nested, err));
+        REQUIRE(nested.size() == 3);
+        REQUIRE(nested[2].size() == 2);
+        REQUIRE(nested[2][1] == 5);
+
+        std::map<std::string, std::string> strings;
+        REQUIRE(from_cbor_string(std::string("\xbf\x7f\x63" "key" "\x61" "s\xff\xc1\x45" "bytes"
+                                             "\x62" "k2" "\x5f\x42" "ab\x41" "c\xff\xff", 27), strings, err));
+        REQUIRE(strings.size() == 2);
+        REQUIRE(strings["keys"] == "bytes");
+        REQUIRE(strings["k2"] == "abc");
+
+        // A document owns its strings, rather than pointing into the input
+        {
+            std::string encoded("\xa1\x63" "key" "\x65" "value", 11);
+            rapidjson::Document doc;
+            REQUIRE(from_cbor_string(encoded, doc, err));
+            encoded.assign(encoded.size(), 'x');
+            REQUIRE(to_json_string(doc) == "{\"key\":\"value\"}");
+        }
+
+        std::string output;
+        StringOutputStream os(output);
+        CborWriter<StringOutputStream> writer(os);
+        writer.Bytes("\x00\x01", 2);
+        REQUIRE(output == std::string("\x42\x00\x01", 3));
+    }
+
+    SECTION("Test for malformed input", "[cbor], [error]")
+    {
+        std::vector<int> numbers;
+        REQUIRE(!from_cbor_string(std::string("\x82\x01", 2), numbers, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+
+        REQUIRE(!from_cbor_string(std::string("\x9f\x01", 2), numbers, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+
+        REQUIRE(!from_cbor_string(std::string("\x81\x01\x01", 3), numbers, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorDocumentRootNotSingular);
+
+        REQUIRE(!from_cbor_string(std::string("\x9b\xff\xff\xff\xff\xff\xff\xff\xff", 9), numbers, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+
+        std::map<std::string, int> mapping;
+        REQUIRE(!from_cbor_string(std::string("\xa1\x01\x01", 3), mapping, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorObjectMissName);
+
+        REQUIRE(!from_cbor_string(std::string("\xbf\x61" "a\xff", 4), mapping, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+    }
+}
+
+TEST_CASE("Test for the binary format", "[binary]")
+{
+    ParsingResult err;
+
+    SECTION("Test for round trip of generated classes", "[binary]")
+    {
+        std::vector<User> users;
+        bool success = from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+
+        std::string encoded = to_binary_string(users);
+        REQUIRE(encoded.size() < to_cbor_string(users).size());
+
+        std::vector<User> decoded;
+        success = from_binary_string(encoded, decoded, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+        REQUIRE(to_json_string(decoded) == to_json_string(users));
+    }
+
+    SECTION("Test for the encoding", "[binary]")
+    {
+        std::string encoded = to_binary_string(create_date(2020, 3, 4));
+        REQUIRE(encoded.substr(0, 4) == "AJXB");
+        REQUIRE(encoded.substr(12) == std::string("\x07\x08\xc8\x1f\x10\x06\x18\x08", 8));
+
+        std::vector<int> numbers;
+        numbers.push_back(-1);
+        numbers.push_back(300);
+        REQUIRE(to_binary_string(numbers).substr(12) == std::string("\x03\x01\xd8\x04", 4));
+    }
+
+    SECTION("Test for unknown fields", "[binary]")
+    {
+        std::string header = to_binary_string(Date()).substr(0, 12);
+        Date date;
+        REQUIRE(from_binary_string(header + std::string("\x0d\x08\xc8\x1f\x48\x05\x52\x02xy\x10\x06\x18\x08", 14), date, err));
+        REQUIRE(date.year == 2020);
+        REQUIRE(date.month == 3);
+        REQUIRE(date.day == 4);
+    }
+
+    SECTION("Test for mismatched schema", "[binary], [error]")
+    {
+        std::vector<Date> dates;
+        REQUIRE(!from_binary_string(to_binary_string(std::vector<BlockEvent>(1)), dates, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorTermination);
+        REQUIRE(err.error_stack().innermost_type() == error::SCHEMA_MISMATCH);
+    }
+
+    SECTION("Test for malformed input", "[binary], [error]")
+    {
+        std::string encoded = to_binary_string(create_date(2020, 3, 4));
+        Date date;
+        REQUIRE(!from_binary_string(encoded.substr(0, encoded.size() - 1), date, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+
+        REQUIRE(!from_binary_string(encoded + '\0', date, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorDocumentRootNotSingular);
+
+        REQUIRE(!from_binary_string("not binary at all", date, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+    }
+
+#if AUTOJSONCXX_HAS_VARIADIC_TEMPLATE
+    SECTION("Test for types embedded as CBOR", "[binary], [tuple]")
+    {
+        std::map<std::string, std::tuple<int, std::string> > mapping;
+        mapping["one"] = std::make_tuple(1, std::string("first"));
+        mapping["two"] = std::make_tuple(2, std::string("second"));
+
+        std::map<std::string, std::tuple<int, std::string> > decoded;
+        REQUIRE(from_binary_string(to_binary_string(mapping), decoded, err));
+        REQUIRE(decoded == mapping);
+    }
+#endif
+}
+
+TEST_CASE("Test for snapshots", "[snapshot]")
+{
+    std::vector<User> users;
+    ParsingResult err;
+
+    bool success = from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err);
+    {
+        CAPTURE(err.description());
+        REQUIRE(success);
+    }
+
+    std::string snapshot = write_snapshot(users);
+    REQUIRE(snapshot.size() % 8 == 0);
+
+    SECTION("Test for reading values in place", "[snapshot]")
+    {
+        snapshot::ListView<User> view;
+        success = open_snapshot<std::vector<User> >(snapshot.data(), snapshot.size(), view, err);
+        {
+            CAPTURE(err.description());
+            REQUIRE(success);
+        }
+        REQUIRE(view.size() == users.size());
+
+        for (std::size_t i = 0; i < users.size(); ++i) {
+            const User& user = users[i];
+            SnapshotView<User> u = view[i];
+            REQUIRE(u.ID() == user.ID);
+            REQUIRE(u.nickname() == user.nickname);
+            REQUIRE(u.birthday().year() == user.birthday.year);
+            REQUIRE(u.birthday().day() == user.birthday.day);
+            REQUIRE(u.block_event().is_null() == !user.block_event);
+            if (user.block_event) {
+                REQUIRE(u.block_event().get().admin_ID() == user.block_event->admin_ID);
+                REQUIRE(u.block_event().get().details() == user.block_event->details);
+            }
+            REQUIRE(u.dark_history().size() == user.dark_history.size());
+            for (std::size_t j = 0; j < user.dark_history.size(); ++j)
+                REQUIRE(u.dark_history()[j].date().month() == user.dark_history[j].date.month);
+
+            snapshot::MapView<std::string> attributes = u.optional_attributes();
+            REQUIRE(attributes.size() == user.optional_attributes.size());
+            typedef std::map<std::string, std::string>::const_iterator iterator;
+            for (iterator it = user.optional_attributes.begin(); it != user.optional_attributes.end(); ++it)
+                REQUIRE(attributes.value(attributes.find(it->first)) == it->second);
+            REQUIRE(attributes.find("no such key") == attributes.size());
+        }
+    }
+
+    SECTION("Test for mismatched and corrupted snapshots", "[snapshot], [error]")
+    {
+        snapshot::ListView<Date> dates;
+        REQUIRE(!open_snapshot<std::vector<Date> >(snapshot.data(), snapshot.size(), dates, err));
+        REQUIRE(err.error_stack().innermost_type() == error::SCHEMA_MISMATCH);
+
+        snapshot::ListView<User> view;
+        REQUIRE(!open_snapshot<std::vector<User> >(snapshot.data(), 10, view, err));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorValueInvalid);
+
+        // Truncated data reads as empty values instead of going out of bounds
+        REQUIRE(open_snapshot<std::vector<User> >(snapshot.data(), 200, view, err));
+        for (std::size_t i = 0; i < view.size(); ++i)
+            REQUIRE(view[i].nickname().size() <= 200);
+        REQUIRE(view[view.size()].ID() == 0);
+    }
+}
+
+#ifdef AUTOJSONCXX_ENABLE_FAST_NUMBERS
+
+TEST_CASE("Test for the fast number parsing policy", "[parsing], [numbers]")
+{
+    ParsingResult err;
+
+    SECTION("Test for correctly rounded doubles", "[parsing], [numbers]")
+    {
+        const char* hard_cases[] = {
+            "0.1", "-2.5e-3", "1e23", "9007199254740993.0", "9007199254740993.0000000000000000001",
+            "2.2250738585072011e-308", "2.2250738585072014e-308", "4.9406564584124654e-324", "1e-400",
+            "3.14159265358979323846264338327950288419716939937510", "1.7976931348623157e308",
+            "7.0420557077594588669468784357561207962098443483187940792729600000e59",
+            "0.000000000000000000000000000000000000000000001e45", "123456789012345678901234567890"
+        };
+
+        std::string json = "[";
+        std::vector<double> expected;
+        for (std::size_t i = 0; i < sizeof(hard_cases) / sizeof(hard_cases[0]); ++i) {
+            json += hard_cases[i];
+            json += ',';
+            expected.push_back(std::strtod(hard_cases[i], 0));
+        }
+
+        utility::uint64_t state = 88172645463325252ULL;
+        for (int i = 0; i < 20000; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            double d;
+            std::memcpy(&d, &state, sizeof(d));
+            if (!utility::is_finite(d))
+                continue;
+            char text[64];
+            std::sprintf(text, "%.*e", static_cast<int>(state % 18), d);
+            json += text;
+            json += ',';
+            expected.push_back(std::strtod(text, 0));
+        }
+        json[json.size() - 1] = ']';
+
+        std::vector<double> parsed;
+        REQUIRE(from_json_string(json, parsed, err, FastNumberReaderPolicy()));
+        REQUIRE(parsed.size() == expected.size());
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < parsed.size(); ++i)
+            mismatches += std::memcmp(&parsed[i], &expected[i], sizeof(double)) != 0;
+        REQUIRE(mismatches == 0);
+
+        // Too large for a double, as `rapidjson::Reader` reports it
+        REQUIRE(!from_json_string("[1e400]", parsed, err, FastNumberReaderPolicy()));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorNumberTooBig);
+        REQUIRE(!from_json_string("[1, -2e999]", parsed, err, FastNumberReaderPolicy()));
+        REQUIRE(err.error_code() == rapidjson::kParseErrorNumberTooBig);
+    }
+
+    SECTION("Test for integers and generated classes", "[parsing], [numbers]")
+    {
+        std::vector<utility::int64_t> integers;
+        REQUIRE(from_json_string("[0, -1, 4294967295, -2147483648, -9223372036854775808, 9223372036854775807]",
+                                 integers, err, FastNumberReaderPolicy()));
+        REQUIRE(integers.size() == 6);
+        REQUIRE(integers[2] == 4294967295LL);
+        REQUIRE(integers[4] == std::numeric_limits<utility::int64_t>::min());
+
+        REQUIRE(!from_json_string("[18446744073709551616]", integers, err, FastNumberReaderPolicy()));
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
+
+        std::vector<User> users;
+        REQUIRE(from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/success/user_array.json", users, err));
+        std::vector<User> fast_users;
+        REQUIRE(from_json_string(to_json_string(users), fast_users, err, FastNumberReaderPolicy()));
+        REQUIRE(to_json_string(fast_users) == to_json_string(users));
+    }
+}
+
+#endif
+
 TEST_CASE("Test for DOM support", "[DOM]")
 {
     rapidjson::Document doc;
@@ -499,7 +1863,7 @@ TEST_CASE("Test for parsing tuple type", "[parsing], [tuple]")
         REQUIRE(!from_json_file(AUTOJSONCXX_ROOT_DIRECTORY "/examples/failure/hard.json", hetero_array, err));
         CAPTURE(err.description());
         REQUIRE(!err.error_stack().empty());
-        REQUIRE(err.begin()->type() == error::TYPE_MISMATCH);
+        REQUIRE(err.error_stack().innermost_type() == error::TYPE_MISMATCH);
         REQUIRE(static_cast<const error::TypeMismatchError&>(*err.begin()).actual_type() == "null");
     }
 }
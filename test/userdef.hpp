@@ -0,0 +1,7442 @@
+#pragma once
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+struct Date {
+ int year;
+int month;
+int day;
+
+explicit Date():year(), month(), day() {  }
+
+
+ 
+};
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::Date > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< int > handler_0;
+SAXEventHandler< int > handler_1;
+SAXEventHandler< int > handler_2;
+utility::uint64_t has_flags[1];
+std::string unknown_key;
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "year";
+case 1:
+    return "month";
+case 2:
+    return "day";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::Date * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->year)
+, handler_1(&obj->month)
+, handler_2(&obj->day)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x79\x65\x61\x72", 4))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x6d\x6f\x6e\x74\x68", 5))
+                         { state=1;  has_flags[0] |= 0x2ULL; }
+else if (utility::string_equal(str, length, "\x64\x61\x79", 3))
+                         { state=2;  has_flags[0] |= 0x4ULL; }
+            else {
+                state = -1;
+                unknown_key.assign(str, length);
+the_error.set<error::UnknownFieldError>(unknown_key.data(), length);
+return false;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     has_flags[0] |= 0x2ULL;
+    break;
+
+case 2:
+    state = 2;
+     has_flags[0] |= 0x4ULL;
+    break;
+
+        default:
+            state = -1;
+            the_error.set<error::ArrayLengthMismatchError>(3, static_cast<std::size_t>(index) + 1);
+return false;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x7ULL) != 0x7ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "year");
+if (!(has_flags[0] & 0x2ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "month");
+if (!(has_flags[0] & 0x4ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "day");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93 >
+struct Serializer< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93, ::Date > {
+
+    void operator()( Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93& w, const ::Date& value) const
+    {
+        ContainerStarter< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93 >::object(w, 3);
+
+        KeyWriter< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93 >()(w, "\x79\x65\x61\x72", 4, "\x22\x79\x65\x61\x72\x22\x3a", 7);
+Serializer< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93, int >()(w, value.year);
+KeyWriter< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93 >()(w, "\x6d\x6f\x6e\x74\x68", 5, "\x2c\x22\x6d\x6f\x6e\x74\x68\x22\x3a", 9);
+Serializer< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93, int >()(w, value.month);
+KeyWriter< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93 >()(w, "\x64\x61\x79", 3, "\x2c\x22\x64\x61\x79\x22\x3a", 7);
+Serializer< Writerfa5bc90017d23cbd7692b0f64ca9f1be872c41174efb176ed57044e1870a2e93, int >()(w, value.day);
+
+        w.EndObject(3);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::Date > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x74c3c0d34da5cbcaULL;
+    }
+
+    static void write(BinaryOutput& out, const ::Date& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< int >::wire_type);
+BinaryCodec< int >::write(out, value.year);
+out.put_tag(2, BinaryCodec< int >::wire_type);
+BinaryCodec< int >::write(out, value.month);
+out.put_tag(3, BinaryCodec< int >::wire_type);
+BinaryCodec< int >::write(out, value.day);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::Date& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< int >::wire_type
+        || !BinaryCodec< int >::read(in, value.year))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< int >::wire_type
+        || !BinaryCodec< int >::read(in, value.month))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< int >::wire_type
+        || !BinaryCodec< int >::read(in, value.day))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::Date > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 3 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< int >::view_type year() const
+{
+    return SnapshotTraits< int >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< int >::view_type month() const
+{
+    return SnapshotTraits< int >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< int >::view_type day() const
+{
+    return SnapshotTraits< int >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::Date > {
+    typedef SnapshotView< ::Date > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::Date& value)
+    {
+        std::size_t table = builder.allocate(3 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< int >::write(builder, table + 0 * snapshot::slot_size, value.year);
+SnapshotTraits< int >::write(builder, table + 1 * snapshot::slot_size, value.month);
+SnapshotTraits< int >::write(builder, table + 2 * snapshot::slot_size, value.day);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { namespace event { struct BlockEvent {
+ unsigned long long serial_number;
+unsigned long long admin_ID;
+Date date;
+std::string description;
+std::string details;
+
+explicit BlockEvent():serial_number(), admin_ID(255), date(), description("\x2f\x2a\x20\x69\x6e\x69\x74\x20\x2a\x2f\x20\x74\x72\x79\x69\x6e\x67\x20\x74\x6f\x20\x6d\x65\x73\x73\x20\x75\x70\x20\x77\x69\x74\x68\x20\x74\x68\x65\x20\x63\x6f\x64\x65\x20\x67\x65\x6e\x65\x72\x61\x74\x6f\x72"), details() { date.year = 1970; date.month = 1; date.day = 1; /* Assign date to the UNIX epoch */ }
+
+
+ 
+}; }
+ }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::event::BlockEvent > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< unsigned long long > handler_0;
+SAXEventHandler< unsigned long long > handler_1;
+SAXEventHandler< Date > handler_2;
+SAXEventHandler< std::string > handler_3;
+SAXEventHandler< std::string > handler_4;
+utility::uint64_t has_flags[1];
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "serial_number";
+case 1:
+    return "admin_ID";
+case 2:
+    return "date";
+case 3:
+    return "description";
+case 4:
+    return "details";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::event::BlockEvent * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->serial_number)
+, handler_1(&obj->admin_ID)
+, handler_2(&obj->date)
+, handler_3(&obj->description)
+, handler_4(&obj->details)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+case 3:
+    return checked_event_forwarding(handler_3.Null());
+
+case 4:
+    return checked_event_forwarding(handler_4.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+case 3:
+    return checked_event_forwarding(handler_3.Bool(b));
+
+case 4:
+    return checked_event_forwarding(handler_4.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+case 3:
+    return checked_event_forwarding(handler_3.Double(d));
+
+case 4:
+    return checked_event_forwarding(handler_4.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.String(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x73\x65\x72\x69\x61\x6c\x5f\x6e\x75\x6d\x62\x65\x72", 13))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x61\x64\x6d\x69\x6e\x69\x73\x74\x72\x61\x74\x6f\x72\x20\x49\x44", 16))
+                         { state=1;   }
+else if (utility::string_equal(str, length, "\x64\x61\x74\x65", 4))
+                         { state=2;   }
+else if (utility::string_equal(str, length, "\x64\x65\x73\x63\x72\x69\x70\x74\x69\x6f\x6e", 11))
+                         { state=3;   }
+else if (utility::string_equal(str, length, "\x64\x65\x74\x61\x69\x6c\x73", 7))
+                         { state=4;   }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.Key(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     
+    break;
+
+case 2:
+    state = 2;
+     
+    break;
+
+case 3:
+    state = 3;
+     
+    break;
+
+case 4:
+    state = 4;
+     
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartArray());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndArray(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartObject());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndObject(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x1ULL) != 0x1ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "serial_number");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+case 3:
+     handler_3.ReapError(errs); break;
+case 4:
+     handler_4.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+handler_3.PrepareForReuse();
+handler_4.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61 >
+struct Serializer< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61, ::config::event::BlockEvent > {
+
+    void operator()( Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61& w, const ::config::event::BlockEvent& value) const
+    {
+        ContainerStarter< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61 >::object(w, 5);
+
+        KeyWriter< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61 >()(w, "\x73\x65\x72\x69\x61\x6c\x5f\x6e\x75\x6d\x62\x65\x72", 13, "\x22\x73\x65\x72\x69\x61\x6c\x5f\x6e\x75\x6d\x62\x65\x72\x22\x3a", 16);
+Serializer< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61, unsigned long long >()(w, value.serial_number);
+KeyWriter< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61 >()(w, "\x61\x64\x6d\x69\x6e\x69\x73\x74\x72\x61\x74\x6f\x72\x20\x49\x44", 16, "\x2c\x22\x61\x64\x6d\x69\x6e\x69\x73\x74\x72\x61\x74\x6f\x72\x20\x49\x44\x22\x3a", 20);
+Serializer< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61, unsigned long long >()(w, value.admin_ID);
+KeyWriter< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61 >()(w, "\x64\x61\x74\x65", 4, "\x2c\x22\x64\x61\x74\x65\x22\x3a", 8);
+Serializer< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61, Date >()(w, value.date);
+KeyWriter< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61 >()(w, "\x64\x65\x73\x63\x72\x69\x70\x74\x69\x6f\x6e", 11, "\x2c\x22\x64\x65\x73\x63\x72\x69\x70\x74\x69\x6f\x6e\x22\x3a", 15);
+Serializer< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61, std::string >()(w, value.description);
+KeyWriter< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61 >()(w, "\x64\x65\x74\x61\x69\x6c\x73", 7, "\x2c\x22\x64\x65\x74\x61\x69\x6c\x73\x22\x3a", 11);
+Serializer< Writera676d360d5103b1cb041f1feed33bb0cf348e10c9c580a0cb7e34c6e5618dc61, std::string >()(w, value.details);
+
+        w.EndObject(5);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::event::BlockEvent > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x7c560037fc725832ULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::event::BlockEvent& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< unsigned long long >::wire_type);
+BinaryCodec< unsigned long long >::write(out, value.serial_number);
+out.put_tag(2, BinaryCodec< unsigned long long >::wire_type);
+BinaryCodec< unsigned long long >::write(out, value.admin_ID);
+out.put_tag(3, BinaryCodec< Date >::wire_type);
+BinaryCodec< Date >::write(out, value.date);
+out.put_tag(4, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.description);
+out.put_tag(5, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.details);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::event::BlockEvent& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< unsigned long long >::wire_type
+        || !BinaryCodec< unsigned long long >::read(in, value.serial_number))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< unsigned long long >::wire_type
+        || !BinaryCodec< unsigned long long >::read(in, value.admin_ID))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< Date >::wire_type
+        || !BinaryCodec< Date >::read(in, value.date))
+        return false;
+    break;
+case 4:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.description))
+        return false;
+    break;
+case 5:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.details))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::event::BlockEvent > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 5 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< unsigned long long >::view_type serial_number() const
+{
+    return SnapshotTraits< unsigned long long >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< unsigned long long >::view_type admin_ID() const
+{
+    return SnapshotTraits< unsigned long long >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< Date >::view_type date() const
+{
+    return SnapshotTraits< Date >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::string >::view_type description() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 3 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::string >::view_type details() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 4 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::event::BlockEvent > {
+    typedef SnapshotView< ::config::event::BlockEvent > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::event::BlockEvent& value)
+    {
+        std::size_t table = builder.allocate(5 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< unsigned long long >::write(builder, table + 0 * snapshot::slot_size, value.serial_number);
+SnapshotTraits< unsigned long long >::write(builder, table + 1 * snapshot::slot_size, value.admin_ID);
+SnapshotTraits< Date >::write(builder, table + 2 * snapshot::slot_size, value.date);
+SnapshotTraits< std::string >::write(builder, table + 3 * snapshot::slot_size, value.description);
+SnapshotTraits< std::string >::write(builder, table + 4 * snapshot::slot_size, value.details);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct User {
+ unsigned long long ID;
+std::string nickname;
+Date birthday;
+std::shared_ptr<config::event::BlockEvent> block_event;
+std::vector<config::event::BlockEvent> dark_history;
+std::map<std::string, std::string> optional_attributes;
+
+explicit User():ID(), nickname("\xe2\x9d\xb6\xe2\x9d\xb7\xe2\x9d\xb8"), birthday(), block_event(), dark_history(), optional_attributes() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::User > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< unsigned long long > handler_0;
+SAXEventHandler< std::string > handler_1;
+SAXEventHandler< Date > handler_2;
+SAXEventHandler< std::shared_ptr<config::event::BlockEvent> > handler_3;
+SAXEventHandler< std::vector<config::event::BlockEvent> > handler_4;
+SAXEventHandler< std::map<std::string, std::string> > handler_5;
+utility::uint64_t has_flags[1];
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "ID";
+case 1:
+    return "nickname";
+case 2:
+    return "birthday";
+case 3:
+    return "block_event";
+case 4:
+    return "dark_history";
+case 5:
+    return "optional_attributes";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::User * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->ID)
+, handler_1(&obj->nickname)
+, handler_2(&obj->birthday)
+, handler_3(&obj->block_event)
+, handler_4(&obj->dark_history)
+, handler_5(&obj->optional_attributes)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+case 3:
+    return checked_event_forwarding(handler_3.Null());
+
+case 4:
+    return checked_event_forwarding(handler_4.Null());
+
+case 5:
+    return checked_event_forwarding(handler_5.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+case 3:
+    return checked_event_forwarding(handler_3.Bool(b));
+
+case 4:
+    return checked_event_forwarding(handler_4.Bool(b));
+
+case 5:
+    return checked_event_forwarding(handler_5.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int64(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint64(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+case 3:
+    return checked_event_forwarding(handler_3.Double(d));
+
+case 4:
+    return checked_event_forwarding(handler_4.Double(d));
+
+case 5:
+    return checked_event_forwarding(handler_5.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.String(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.String(str, length, copy));
+
+case 5:
+    return checked_event_forwarding(handler_5.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x49\x44", 2))
+                         { state=0; if (has_flags[0] & 0x1ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x6e\x69\x63\x6b\x6e\x61\x6d\x65", 8))
+                         { state=1; if (has_flags[0] & 0x2ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x2ULL; }
+else if (utility::string_equal(str, length, "\x62\x69\x72\x74\x68\x64\x61\x79", 8))
+                         { state=2; if (has_flags[0] & 0x4ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x4ULL; }
+else if (utility::string_equal(str, length, "\x62\x6c\x6f\x63\x6b\x5f\x65\x76\x65\x6e\x74", 11))
+                         { state=3; if (has_flags[0] & 0x8ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x8ULL; }
+else if (utility::string_equal(str, length, "\x64\x61\x72\x6b\x5f\x68\x69\x73\x74\x6f\x72\x79", 12))
+                         { state=4; if (has_flags[0] & 0x10ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x10ULL; }
+else if (utility::string_equal(str, length, "\x6f\x70\x74\x69\x6f\x6e\x61\x6c\x5f\x61\x74\x74\x72\x69\x62\x75\x74\x65\x73", 19))
+                         { state=5; if (has_flags[0] & 0x20ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x20ULL; }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.Key(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.Key(str, length, copy));
+
+case 5:
+    return checked_event_forwarding(handler_5.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+    if (has_flags[0] & 0x1ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+    if (has_flags[0] & 0x2ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x2ULL;
+    break;
+
+case 2:
+    state = 2;
+    if (has_flags[0] & 0x4ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x4ULL;
+    break;
+
+case 3:
+    state = 3;
+    if (has_flags[0] & 0x8ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x8ULL;
+    break;
+
+case 4:
+    state = 4;
+    if (has_flags[0] & 0x10ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x10ULL;
+    break;
+
+case 5:
+    state = 5;
+    if (has_flags[0] & 0x20ULL) the_error.set<error::DuplicateKeyError>(current_member_name());
+ has_flags[0] |= 0x20ULL;
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartArray());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartArray());
+
+case 5:
+    return checked_event_forwarding(handler_5.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndArray(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndArray(length));
+
+case 5:
+    return checked_event_forwarding(handler_5.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartObject());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartObject());
+
+case 5:
+    return checked_event_forwarding(handler_5.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndObject(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndObject(length));
+
+case 5:
+    return checked_event_forwarding(handler_5.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x3ULL) != 0x3ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "ID");
+if (!(has_flags[0] & 0x2ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "nickname");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+case 3:
+     handler_3.ReapError(errs); break;
+case 4:
+     handler_4.ReapError(errs); break;
+case 5:
+     handler_5.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+handler_3.PrepareForReuse();
+handler_4.PrepareForReuse();
+handler_5.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >
+struct Serializer< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65, ::config::User > {
+
+    void operator()( Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65& w, const ::config::User& value) const
+    {
+        ContainerStarter< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >::object(w, 6);
+
+        KeyWriter< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >()(w, "\x49\x44", 2, "\x22\x49\x44\x22\x3a", 5);
+Serializer< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65, unsigned long long >()(w, value.ID);
+KeyWriter< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >()(w, "\x6e\x69\x63\x6b\x6e\x61\x6d\x65", 8, "\x2c\x22\x6e\x69\x63\x6b\x6e\x61\x6d\x65\x22\x3a", 12);
+Serializer< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65, std::string >()(w, value.nickname);
+KeyWriter< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >()(w, "\x62\x69\x72\x74\x68\x64\x61\x79", 8, "\x2c\x22\x62\x69\x72\x74\x68\x64\x61\x79\x22\x3a", 12);
+Serializer< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65, Date >()(w, value.birthday);
+KeyWriter< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >()(w, "\x62\x6c\x6f\x63\x6b\x5f\x65\x76\x65\x6e\x74", 11, "\x2c\x22\x62\x6c\x6f\x63\x6b\x5f\x65\x76\x65\x6e\x74\x22\x3a", 15);
+Serializer< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65, std::shared_ptr<config::event::BlockEvent> >()(w, value.block_event);
+KeyWriter< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >()(w, "\x64\x61\x72\x6b\x5f\x68\x69\x73\x74\x6f\x72\x79", 12, "\x2c\x22\x64\x61\x72\x6b\x5f\x68\x69\x73\x74\x6f\x72\x79\x22\x3a", 16);
+Serializer< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65, std::vector<config::event::BlockEvent> >()(w, value.dark_history);
+KeyWriter< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65 >()(w, "\x6f\x70\x74\x69\x6f\x6e\x61\x6c\x5f\x61\x74\x74\x72\x69\x62\x75\x74\x65\x73", 19, "\x2c\x22\x6f\x70\x74\x69\x6f\x6e\x61\x6c\x5f\x61\x74\x74\x72\x69\x62\x75\x74\x65\x73\x22\x3a", 23);
+Serializer< Writer0c5f9d00c9a11a0fcef46bb482a11055393a61eae6d7ed51636e375896bbea65, std::map<std::string, std::string> >()(w, value.optional_attributes);
+
+        w.EndObject(6);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::User > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x06d8f75faad5696bULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::User& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< unsigned long long >::wire_type);
+BinaryCodec< unsigned long long >::write(out, value.ID);
+out.put_tag(2, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.nickname);
+out.put_tag(3, BinaryCodec< Date >::wire_type);
+BinaryCodec< Date >::write(out, value.birthday);
+out.put_tag(4, BinaryCodec< std::shared_ptr<config::event::BlockEvent> >::wire_type);
+BinaryCodec< std::shared_ptr<config::event::BlockEvent> >::write(out, value.block_event);
+out.put_tag(5, BinaryCodec< std::vector<config::event::BlockEvent> >::wire_type);
+BinaryCodec< std::vector<config::event::BlockEvent> >::write(out, value.dark_history);
+out.put_tag(6, BinaryCodec< std::map<std::string, std::string> >::wire_type);
+BinaryCodec< std::map<std::string, std::string> >::write(out, value.optional_attributes);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::User& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< unsigned long long >::wire_type
+        || !BinaryCodec< unsigned long long >::read(in, value.ID))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.nickname))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< Date >::wire_type
+        || !BinaryCodec< Date >::read(in, value.birthday))
+        return false;
+    break;
+case 4:
+    if (wire_type != BinaryCodec< std::shared_ptr<config::event::BlockEvent> >::wire_type
+        || !BinaryCodec< std::shared_ptr<config::event::BlockEvent> >::read(in, value.block_event))
+        return false;
+    break;
+case 5:
+    if (wire_type != BinaryCodec< std::vector<config::event::BlockEvent> >::wire_type
+        || !BinaryCodec< std::vector<config::event::BlockEvent> >::read(in, value.dark_history))
+        return false;
+    break;
+case 6:
+    if (wire_type != BinaryCodec< std::map<std::string, std::string> >::wire_type
+        || !BinaryCodec< std::map<std::string, std::string> >::read(in, value.optional_attributes))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::User > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 6 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< unsigned long long >::view_type ID() const
+{
+    return SnapshotTraits< unsigned long long >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::string >::view_type nickname() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< Date >::view_type birthday() const
+{
+    return SnapshotTraits< Date >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::shared_ptr<config::event::BlockEvent> >::view_type block_event() const
+{
+    return SnapshotTraits< std::shared_ptr<config::event::BlockEvent> >::view(m_region, m_table + 3 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::vector<config::event::BlockEvent> >::view_type dark_history() const
+{
+    return SnapshotTraits< std::vector<config::event::BlockEvent> >::view(m_region, m_table + 4 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::map<std::string, std::string> >::view_type optional_attributes() const
+{
+    return SnapshotTraits< std::map<std::string, std::string> >::view(m_region, m_table + 5 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::User > {
+    typedef SnapshotView< ::config::User > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::User& value)
+    {
+        std::size_t table = builder.allocate(6 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< unsigned long long >::write(builder, table + 0 * snapshot::slot_size, value.ID);
+SnapshotTraits< std::string >::write(builder, table + 1 * snapshot::slot_size, value.nickname);
+SnapshotTraits< Date >::write(builder, table + 2 * snapshot::slot_size, value.birthday);
+SnapshotTraits< std::shared_ptr<config::event::BlockEvent> >::write(builder, table + 3 * snapshot::slot_size, value.block_event);
+SnapshotTraits< std::vector<config::event::BlockEvent> >::write(builder, table + 4 * snapshot::slot_size, value.dark_history);
+SnapshotTraits< std::map<std::string, std::string> >::write(builder, table + 5 * snapshot::slot_size, value.optional_attributes);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct Reading {
+ double celsius;
+double humidity;
+std::vector<double> samples;
+
+explicit Reading():celsius(), humidity(), samples() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::Reading > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< double > handler_0;
+SAXEventHandler< double > handler_1;
+SAXEventHandler< std::vector<double> > handler_2;
+utility::uint64_t has_flags[1];
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "celsius";
+case 1:
+    return "humidity";
+case 2:
+    return "samples";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::Reading * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->celsius)
+, handler_1(&obj->humidity)
+, handler_2(&obj->samples)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x63\x65\x6c\x73\x69\x75\x73", 7))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x68\x75\x6d\x69\x64\x69\x74\x79", 8))
+                         { state=1;   }
+else if (utility::string_equal(str, length, "\x73\x61\x6d\x70\x6c\x65\x73", 7))
+                         { state=2;   }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     
+    break;
+
+case 2:
+    state = 2;
+     
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x1ULL) != 0x1ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "celsius");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640 >
+struct Serializer< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640, ::config::Reading > {
+
+    void operator()( Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640& w, const ::config::Reading& value) const
+    {
+        ContainerStarter< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640 >::object(w, 3);
+
+        KeyWriter< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640 >()(w, "\x63\x65\x6c\x73\x69\x75\x73", 7, "\x22\x63\x65\x6c\x73\x69\x75\x73\x22\x3a", 10);
+FixedPointSerializer< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640 >(1, false)(w, value.celsius);
+KeyWriter< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640 >()(w, "\x68\x75\x6d\x69\x64\x69\x74\x79", 8, "\x2c\x22\x68\x75\x6d\x69\x64\x69\x74\x79\x22\x3a", 12);
+FixedPointSerializer< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640 >(3, true)(w, value.humidity);
+KeyWriter< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640 >()(w, "\x73\x61\x6d\x70\x6c\x65\x73", 7, "\x2c\x22\x73\x61\x6d\x70\x6c\x65\x73\x22\x3a", 11);
+Serializer< Writerc0196724074f5019be4c9b32a3dfd5f859bf46c2a827a2d96f4360708386a640, std::vector<double> >()(w, value.samples);
+
+        w.EndObject(3);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::Reading > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x342b509201532cc0ULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::Reading& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.celsius);
+out.put_tag(2, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.humidity);
+out.put_tag(3, BinaryCodec< std::vector<double> >::wire_type);
+BinaryCodec< std::vector<double> >::write(out, value.samples);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::Reading& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.celsius))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.humidity))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< std::vector<double> >::wire_type
+        || !BinaryCodec< std::vector<double> >::read(in, value.samples))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::Reading > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 3 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< double >::view_type celsius() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< double >::view_type humidity() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::vector<double> >::view_type samples() const
+{
+    return SnapshotTraits< std::vector<double> >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::Reading > {
+    typedef SnapshotView< ::config::Reading > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::Reading& value)
+    {
+        std::size_t table = builder.allocate(3 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< double >::write(builder, table + 0 * snapshot::slot_size, value.celsius);
+SnapshotTraits< double >::write(builder, table + 1 * snapshot::slot_size, value.humidity);
+SnapshotTraits< std::vector<double> >::write(builder, table + 2 * snapshot::slot_size, value.samples);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct Waypoint {
+ double latitude;
+double longitude;
+std::string label;
+Date arrival;
+std::vector<int> tags;
+
+explicit Waypoint():latitude(), longitude(), label("\x75\x6e\x6e\x61\x6d\x65\x64"), arrival(), tags() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class MembersSAXEventHandler< ::config::Waypoint > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< double > handler_0;
+SAXEventHandler< double > handler_1;
+SAXEventHandler< std::string > handler_2;
+SAXEventHandler< Date > handler_3;
+SAXEventHandler< std::vector<int> > handler_4;
+utility::uint64_t has_flags[1];
+std::string unknown_key;
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "latitude";
+case 1:
+    return "longitude";
+case 2:
+    return "label";
+case 3:
+    return "arrival";
+case 4:
+    return "tags";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit MembersSAXEventHandler( ::config::Waypoint * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->latitude)
+, handler_1(&obj->longitude)
+, handler_2(&obj->label)
+, handler_3(&obj->arrival)
+, handler_4(&obj->tags)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+case 3:
+    return checked_event_forwarding(handler_3.Null());
+
+case 4:
+    return checked_event_forwarding(handler_4.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+case 3:
+    return checked_event_forwarding(handler_3.Bool(b));
+
+case 4:
+    return checked_event_forwarding(handler_4.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+case 3:
+    return checked_event_forwarding(handler_3.Double(d));
+
+case 4:
+    return checked_event_forwarding(handler_4.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.String(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x6c\x61\x74\x69\x74\x75\x64\x65", 8))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x6c\x6f\x6e\x67\x69\x74\x75\x64\x65", 9))
+                         { state=1;  has_flags[0] |= 0x2ULL; }
+else if (utility::string_equal(str, length, "\x6c\x61\x62\x65\x6c", 5))
+                         { state=2;   }
+else if (utility::string_equal(str, length, "\x61\x72\x72\x69\x76\x61\x6c", 7))
+                         { state=3;   }
+else if (utility::string_equal(str, length, "\x74\x61\x67\x73", 4))
+                         { state=4;   }
+            else {
+                state = -1;
+                unknown_key.assign(str, length);
+the_error.set<error::UnknownFieldError>(unknown_key.data(), length);
+return false;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.Key(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     has_flags[0] |= 0x2ULL;
+    break;
+
+case 2:
+    state = 2;
+     
+    break;
+
+case 3:
+    state = 3;
+     
+    break;
+
+case 4:
+    state = 4;
+     
+    break;
+
+        default:
+            state = -1;
+            the_error.set<error::ArrayLengthMismatchError>(5, static_cast<std::size_t>(index) + 1);
+return false;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartArray());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndArray(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartObject());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndObject(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x3ULL) != 0x3ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "latitude");
+if (!(has_flags[0] & 0x2ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "longitude");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+case 3:
+     handler_3.ReapError(errs); break;
+case 4:
+     handler_4.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+handler_3.PrepareForReuse();
+handler_4.PrepareForReuse();
+
+    }
+};
+
+template <>
+class SAXEventHandler< ::config::Waypoint > : public PositionalSAXEventHandler< ::config::Waypoint > {
+public:
+    explicit SAXEventHandler( ::config::Waypoint * obj)
+        : PositionalSAXEventHandler< ::config::Waypoint >(obj)
+    {
+    }
+};
+
+template < class Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744 >
+struct Serializer< Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744, ::config::Waypoint > {
+
+    void operator()( Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744& w, const ::config::Waypoint& value) const
+    {
+        ContainerStarter< Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744 >::array(w, 5);
+
+        Serializer< Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744, double >()(w, value.latitude);
+Serializer< Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744, double >()(w, value.longitude);
+Serializer< Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744, std::string >()(w, value.label);
+Serializer< Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744, Date >()(w, value.arrival);
+Serializer< Writer188ec63f64d1c1182c18fd772f6a09d23f72a68be8179ff393ee2945d42e2744, std::vector<int> >()(w, value.tags);
+
+        w.EndArray(5);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::Waypoint > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x15135934f06cb250ULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::Waypoint& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.latitude);
+out.put_tag(2, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.longitude);
+out.put_tag(3, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.label);
+out.put_tag(4, BinaryCodec< Date >::wire_type);
+BinaryCodec< Date >::write(out, value.arrival);
+out.put_tag(5, BinaryCodec< std::vector<int> >::wire_type);
+BinaryCodec< std::vector<int> >::write(out, value.tags);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::Waypoint& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.latitude))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.longitude))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.label))
+        return false;
+    break;
+case 4:
+    if (wire_type != BinaryCodec< Date >::wire_type
+        || !BinaryCodec< Date >::read(in, value.arrival))
+        return false;
+    break;
+case 5:
+    if (wire_type != BinaryCodec< std::vector<int> >::wire_type
+        || !BinaryCodec< std::vector<int> >::read(in, value.tags))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::Waypoint > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 5 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< double >::view_type latitude() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< double >::view_type longitude() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::string >::view_type label() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+
+SnapshotTraits< Date >::view_type arrival() const
+{
+    return SnapshotTraits< Date >::view(m_region, m_table + 3 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::vector<int> >::view_type tags() const
+{
+    return SnapshotTraits< std::vector<int> >::view(m_region, m_table + 4 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::Waypoint > {
+    typedef SnapshotView< ::config::Waypoint > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::Waypoint& value)
+    {
+        std::size_t table = builder.allocate(5 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< double >::write(builder, table + 0 * snapshot::slot_size, value.latitude);
+SnapshotTraits< double >::write(builder, table + 1 * snapshot::slot_size, value.longitude);
+SnapshotTraits< std::string >::write(builder, table + 2 * snapshot::slot_size, value.label);
+SnapshotTraits< Date >::write(builder, table + 3 * snapshot::slot_size, value.arrival);
+SnapshotTraits< std::vector<int> >::write(builder, table + 4 * snapshot::slot_size, value.tags);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+namespace config { enum Availability { InStock, Backorder, Discontinued }; }
+
+
+namespace autojsoncxx {
+
+template <>
+struct EnumTraits< ::config::Availability > {
+    static const char* type_name()
+    {
+        return "::config::Availability";
+    }
+
+    static SizeType count()
+    {
+        return 3;
+    }
+
+    static const EnumSpelling* spellings()
+    {
+        static const EnumSpelling result[] = {
+            { "\x69\x6e\x2d\x73\x74\x6f\x63\x6b", 8, "\x22\x69\x6e\x2d\x73\x74\x6f\x63\x6b\x22", 10 },
+{ "\x42\x61\x63\x6b\x6f\x72\x64\x65\x72", 9, "\x22\x42\x61\x63\x6b\x6f\x72\x64\x65\x72\x22", 11 },
+{ "\x64\x69\x73\x63\x6f\x6e\x74\x69\x6e\x75\x65\x64", 12, "\x22\x64\x69\x73\x63\x6f\x6e\x74\x69\x6e\x75\x65\x64\x22", 14 }
+        };
+        return result;
+    }
+
+    static int find(const char* str, SizeType length)
+    {
+        static const int slots[] = { 0, 1, -1, 2 };
+        return internal::find_spelling(spellings(), str, length, slots, 1u, 3u);
+    }
+};
+
+template <>
+class SAXEventHandler< ::config::Availability > : public EnumSAXEventHandler< ::config::Availability > {
+public:
+    explicit SAXEventHandler( ::config::Availability * value)
+        : EnumSAXEventHandler< ::config::Availability >(value)
+    {
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, ::config::Availability > : public EnumSerializer<Writer, ::config::Availability > {
+};
+}
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct Product {
+ std::string sku;
+std::string title;
+std::string currency;
+double price;
+int rating;
+std::vector<std::string> tags;
+config::Availability availability;
+
+explicit Product():sku(), title(), currency("\x55\x53\x44"), price(), rating(), tags(), availability() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::Product > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< std::string > handler_0;
+SAXEventHandler< std::string > handler_1;
+SAXEventHandler< std::string > handler_2;
+SAXEventHandler< double > handler_3;
+SAXEventHandler< int > handler_4;
+SAXEventHandler< std::vector<std::string> > handler_5;
+SAXEventHandler< config::Availability > handler_6;
+utility::uint64_t has_flags[1];
+::config::Product * object;
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "sku";
+case 1:
+    return "title";
+case 2:
+    return "currency";
+case 3:
+    return "price";
+case 4:
+    return "rating";
+case 5:
+    return "tags";
+case 6:
+    return "availability";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            case 0: {
+static const validation::Pattern pattern("\x5e\x5b\x41\x2d\x5a\x5d\x7b\x33\x7d\x2d\x5b\x30\x2d\x39\x5d\x7b\x34\x7d\x24");
+if (!pattern.search(object->sku)) {
+    the_error.set<error::PatternMismatchError>("sku", "\x5e\x5b\x41\x2d\x5a\x5d\x7b\x33\x7d\x2d\x5b\x30\x2d\x39\x5d\x7b\x34\x7d\x24");
+    return false;
+}
+    break;
+}
+
+case 1: {
+std::size_t length = validation::string_length(object->title);
+if (length < 1 || length > 40) {
+    the_error.set<error::StringLengthError>("title", length, 1, 40);
+    return false;
+}
+    break;
+}
+
+case 2: {
+static const char* const enum_table[] = { "\x45\x55\x52", 0, 0, "\x47\x42\x50", 0, "\x4a\x50\x59", 0, 0, "\x43\x4e\x59", 0, 0, 0, "\x55\x53\x44", 0, 0, 0 };
+static const std::size_t enum_lengths[] = { 3, 0, 0, 3, 0, 3, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0 };
+if (!validation::in_string_set(object->currency, enum_table, enum_lengths, 1u, 15u)) {
+    the_error.set<error::EnumMismatchError>("currency", error::ErrorText(object->currency.data(), object->currency.size()));
+    return false;
+}
+    break;
+}
+
+case 3: {
+if (object->price < 0.0 || object->price > 1000000.0) {
+    the_error.set<error::ValueOutOfBoundsError>("price", static_cast<double>(object->price), 0.0, 1000000.0);
+    return false;
+}
+    break;
+}
+
+case 4: {
+if (object->rating != 1.0 && object->rating != 2.0 && object->rating != 3.0 && object->rating != 4.0 && object->rating != 5.0) {
+    the_error.set<error::EnumMismatchError>("rating");
+    return false;
+}
+    break;
+}
+
+case 5: {
+std::size_t item_count = object->tags.size();
+if (item_count > 5) {
+    the_error.set<error::ItemCountError>("tags", item_count, 0, 5);
+    return false;
+}
+std::size_t duplicate = validation::find_duplicate(object->tags);
+if (duplicate != validation::npos) {
+    the_error.set<error::DuplicateItemsError>("tags", duplicate);
+    return false;
+}
+    break;
+}
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::Product * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->sku)
+, handler_1(&obj->title)
+, handler_2(&obj->currency)
+, handler_3(&obj->price)
+, handler_4(&obj->rating)
+, handler_5(&obj->tags)
+, handler_6(&obj->availability)
+, object(obj)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+case 3:
+    return checked_event_forwarding(handler_3.Null());
+
+case 4:
+    return checked_event_forwarding(handler_4.Null());
+
+case 5:
+    return checked_event_forwarding(handler_5.Null());
+
+case 6:
+    return checked_event_forwarding(handler_6.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+case 3:
+    return checked_event_forwarding(handler_3.Bool(b));
+
+case 4:
+    return checked_event_forwarding(handler_4.Bool(b));
+
+case 5:
+    return checked_event_forwarding(handler_5.Bool(b));
+
+case 6:
+    return checked_event_forwarding(handler_6.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Int(i));
+
+case 6:
+    return checked_event_forwarding(handler_6.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Uint(i));
+
+case 6:
+    return checked_event_forwarding(handler_6.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int64(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Int64(i));
+
+case 6:
+    return checked_event_forwarding(handler_6.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint64(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Uint64(i));
+
+case 6:
+    return checked_event_forwarding(handler_6.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+case 3:
+    return checked_event_forwarding(handler_3.Double(d));
+
+case 4:
+    return checked_event_forwarding(handler_4.Double(d));
+
+case 5:
+    return checked_event_forwarding(handler_5.Double(d));
+
+case 6:
+    return checked_event_forwarding(handler_6.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.String(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.String(str, length, copy));
+
+case 5:
+    return checked_event_forwarding(handler_5.String(str, length, copy));
+
+case 6:
+    return checked_event_forwarding(handler_6.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x73\x6b\x75", 3))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x74\x69\x74\x6c\x65", 5))
+                         { state=1;  has_flags[0] |= 0x2ULL; }
+else if (utility::string_equal(str, length, "\x63\x75\x72\x72\x65\x6e\x63\x79", 8))
+                         { state=2;   }
+else if (utility::string_equal(str, length, "\x70\x72\x69\x63\x65", 5))
+                         { state=3;   }
+else if (utility::string_equal(str, length, "\x72\x61\x74\x69\x6e\x67", 6))
+                         { state=4;   }
+else if (utility::string_equal(str, length, "\x74\x61\x67\x73", 4))
+                         { state=5;   }
+else if (utility::string_equal(str, length, "\x61\x76\x61\x69\x6c\x61\x62\x69\x6c\x69\x74\x79", 12))
+                         { state=6;   }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.Key(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.Key(str, length, copy));
+
+case 5:
+    return checked_event_forwarding(handler_5.Key(str, length, copy));
+
+case 6:
+    return checked_event_forwarding(handler_6.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     has_flags[0] |= 0x2ULL;
+    break;
+
+case 2:
+    state = 2;
+     
+    break;
+
+case 3:
+    state = 3;
+     
+    break;
+
+case 4:
+    state = 4;
+     
+    break;
+
+case 5:
+    state = 5;
+     
+    break;
+
+case 6:
+    state = 6;
+     
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartArray());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartArray());
+
+case 5:
+    return checked_event_forwarding(handler_5.StartArray());
+
+case 6:
+    return checked_event_forwarding(handler_6.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndArray(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndArray(length));
+
+case 5:
+    return checked_event_forwarding(handler_5.EndArray(length));
+
+case 6:
+    return checked_event_forwarding(handler_6.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartObject());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartObject());
+
+case 5:
+    return checked_event_forwarding(handler_5.StartObject());
+
+case 6:
+    return checked_event_forwarding(handler_6.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndObject(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndObject(length));
+
+case 5:
+    return checked_event_forwarding(handler_5.EndObject(length));
+
+case 6:
+    return checked_event_forwarding(handler_6.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x3ULL) != 0x3ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "sku");
+if (!(has_flags[0] & 0x2ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "title");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+case 3:
+     handler_3.ReapError(errs); break;
+case 4:
+     handler_4.ReapError(errs); break;
+case 5:
+     handler_5.ReapError(errs); break;
+case 6:
+     handler_6.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+handler_3.PrepareForReuse();
+handler_4.PrepareForReuse();
+handler_5.PrepareForReuse();
+handler_6.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >
+struct Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, ::config::Product > {
+
+    void operator()( Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663& w, const ::config::Product& value) const
+    {
+        ContainerStarter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >::object(w, 7);
+
+        KeyWriter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >()(w, "\x73\x6b\x75", 3, "\x22\x73\x6b\x75\x22\x3a", 6);
+Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, std::string >()(w, value.sku);
+KeyWriter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >()(w, "\x74\x69\x74\x6c\x65", 5, "\x2c\x22\x74\x69\x74\x6c\x65\x22\x3a", 9);
+Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, std::string >()(w, value.title);
+KeyWriter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >()(w, "\x63\x75\x72\x72\x65\x6e\x63\x79", 8, "\x2c\x22\x63\x75\x72\x72\x65\x6e\x63\x79\x22\x3a", 12);
+Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, std::string >()(w, value.currency);
+KeyWriter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >()(w, "\x70\x72\x69\x63\x65", 5, "\x2c\x22\x70\x72\x69\x63\x65\x22\x3a", 9);
+Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, double >()(w, value.price);
+KeyWriter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >()(w, "\x72\x61\x74\x69\x6e\x67", 6, "\x2c\x22\x72\x61\x74\x69\x6e\x67\x22\x3a", 10);
+Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, int >()(w, value.rating);
+KeyWriter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >()(w, "\x74\x61\x67\x73", 4, "\x2c\x22\x74\x61\x67\x73\x22\x3a", 8);
+Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, std::vector<std::string> >()(w, value.tags);
+KeyWriter< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663 >()(w, "\x61\x76\x61\x69\x6c\x61\x62\x69\x6c\x69\x74\x79", 12, "\x2c\x22\x61\x76\x61\x69\x6c\x61\x62\x69\x6c\x69\x74\x79\x22\x3a", 16);
+Serializer< Writerf0fa12b09704d1b25c22a7807818a86663d3a0b0beb5f2d373e94164f4273663, config::Availability >()(w, value.availability);
+
+        w.EndObject(7);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::Product > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0xb68c6a6115e4b965ULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::Product& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.sku);
+out.put_tag(2, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.title);
+out.put_tag(3, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.currency);
+out.put_tag(4, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.price);
+out.put_tag(5, BinaryCodec< int >::wire_type);
+BinaryCodec< int >::write(out, value.rating);
+out.put_tag(6, BinaryCodec< std::vector<std::string> >::wire_type);
+BinaryCodec< std::vector<std::string> >::write(out, value.tags);
+out.put_tag(7, BinaryCodec< config::Availability >::wire_type);
+BinaryCodec< config::Availability >::write(out, value.availability);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::Product& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.sku))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.title))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.currency))
+        return false;
+    break;
+case 4:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.price))
+        return false;
+    break;
+case 5:
+    if (wire_type != BinaryCodec< int >::wire_type
+        || !BinaryCodec< int >::read(in, value.rating))
+        return false;
+    break;
+case 6:
+    if (wire_type != BinaryCodec< std::vector<std::string> >::wire_type
+        || !BinaryCodec< std::vector<std::string> >::read(in, value.tags))
+        return false;
+    break;
+case 7:
+    if (wire_type != BinaryCodec< config::Availability >::wire_type
+        || !BinaryCodec< config::Availability >::read(in, value.availability))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::Product > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 7 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< std::string >::view_type sku() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::string >::view_type title() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::string >::view_type currency() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+
+SnapshotTraits< double >::view_type price() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 3 * snapshot::slot_size);
+}
+
+SnapshotTraits< int >::view_type rating() const
+{
+    return SnapshotTraits< int >::view(m_region, m_table + 4 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::vector<std::string> >::view_type tags() const
+{
+    return SnapshotTraits< std::vector<std::string> >::view(m_region, m_table + 5 * snapshot::slot_size);
+}
+
+SnapshotTraits< config::Availability >::view_type availability() const
+{
+    return SnapshotTraits< config::Availability >::view(m_region, m_table + 6 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::Product > {
+    typedef SnapshotView< ::config::Product > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::Product& value)
+    {
+        std::size_t table = builder.allocate(7 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< std::string >::write(builder, table + 0 * snapshot::slot_size, value.sku);
+SnapshotTraits< std::string >::write(builder, table + 1 * snapshot::slot_size, value.title);
+SnapshotTraits< std::string >::write(builder, table + 2 * snapshot::slot_size, value.currency);
+SnapshotTraits< double >::write(builder, table + 3 * snapshot::slot_size, value.price);
+SnapshotTraits< int >::write(builder, table + 4 * snapshot::slot_size, value.rating);
+SnapshotTraits< std::vector<std::string> >::write(builder, table + 5 * snapshot::slot_size, value.tags);
+SnapshotTraits< config::Availability >::write(builder, table + 6 * snapshot::slot_size, value.availability);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct Sample {
+ unsigned char channel;
+short offset;
+float value;
+std::vector<signed char> deltas;
+
+explicit Sample():channel(), offset(), value(), deltas() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::Sample > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< unsigned char > handler_0;
+SAXEventHandler< short > handler_1;
+SAXEventHandler< float > handler_2;
+SAXEventHandler< std::vector<signed char> > handler_3;
+utility::uint64_t has_flags[1];
+::config::Sample * object;
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "channel";
+case 1:
+    return "offset";
+case 2:
+    return "value";
+case 3:
+    return "deltas";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            case 0: {
+if (object->channel < 0.0 || object->channel > 255.0) {
+    the_error.set<error::ValueOutOfBoundsError>("channel", static_cast<double>(object->channel), 0.0, 255.0);
+    return false;
+}
+    break;
+}
+
+case 1: {
+if (object->offset < -1000.0 || object->offset > 1000.0) {
+    the_error.set<error::ValueOutOfBoundsError>("offset", static_cast<double>(object->offset), -1000.0, 1000.0);
+    return false;
+}
+    break;
+}
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::Sample * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->channel)
+, handler_1(&obj->offset)
+, handler_2(&obj->value)
+, handler_3(&obj->deltas)
+, object(obj)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+case 3:
+    return checked_event_forwarding(handler_3.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+case 3:
+    return checked_event_forwarding(handler_3.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+case 3:
+    return checked_event_forwarding(handler_3.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x63\x68\x61\x6e\x6e\x65\x6c", 7))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x6f\x66\x66\x73\x65\x74", 6))
+                         { state=1;   }
+else if (utility::string_equal(str, length, "\x76\x61\x6c\x75\x65", 5))
+                         { state=2;  has_flags[0] |= 0x2ULL; }
+else if (utility::string_equal(str, length, "\x64\x65\x6c\x74\x61\x73", 6))
+                         { state=3;   }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     
+    break;
+
+case 2:
+    state = 2;
+     has_flags[0] |= 0x2ULL;
+    break;
+
+case 3:
+    state = 3;
+     
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x3ULL) != 0x3ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "channel");
+if (!(has_flags[0] & 0x2ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "value");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+case 3:
+     handler_3.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+handler_3.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3 >
+struct Serializer< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3, ::config::Sample > {
+
+    void operator()( Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3& w, const ::config::Sample& value) const
+    {
+        ContainerStarter< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3 >::object(w, 4);
+
+        KeyWriter< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3 >()(w, "\x63\x68\x61\x6e\x6e\x65\x6c", 7, "\x22\x63\x68\x61\x6e\x6e\x65\x6c\x22\x3a", 10);
+Serializer< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3, unsigned char >()(w, value.channel);
+KeyWriter< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3 >()(w, "\x6f\x66\x66\x73\x65\x74", 6, "\x2c\x22\x6f\x66\x66\x73\x65\x74\x22\x3a", 10);
+Serializer< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3, short >()(w, value.offset);
+KeyWriter< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3 >()(w, "\x76\x61\x6c\x75\x65", 5, "\x2c\x22\x76\x61\x6c\x75\x65\x22\x3a", 9);
+Serializer< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3, float >()(w, value.value);
+KeyWriter< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3 >()(w, "\x64\x65\x6c\x74\x61\x73", 6, "\x2c\x22\x64\x65\x6c\x74\x61\x73\x22\x3a", 10);
+Serializer< Writer519a607246358f7436c4eba31e463a15678883f500a4b5e51138f98970bde9e3, std::vector<signed char> >()(w, value.deltas);
+
+        w.EndObject(4);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::Sample > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x97e04157efe5123fULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::Sample& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< unsigned char >::wire_type);
+BinaryCodec< unsigned char >::write(out, value.channel);
+out.put_tag(2, BinaryCodec< short >::wire_type);
+BinaryCodec< short >::write(out, value.offset);
+out.put_tag(3, BinaryCodec< float >::wire_type);
+BinaryCodec< float >::write(out, value.value);
+out.put_tag(4, BinaryCodec< std::vector<signed char> >::wire_type);
+BinaryCodec< std::vector<signed char> >::write(out, value.deltas);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::Sample& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< unsigned char >::wire_type
+        || !BinaryCodec< unsigned char >::read(in, value.channel))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< short >::wire_type
+        || !BinaryCodec< short >::read(in, value.offset))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< float >::wire_type
+        || !BinaryCodec< float >::read(in, value.value))
+        return false;
+    break;
+case 4:
+    if (wire_type != BinaryCodec< std::vector<signed char> >::wire_type
+        || !BinaryCodec< std::vector<signed char> >::read(in, value.deltas))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::Sample > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 4 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< unsigned char >::view_type channel() const
+{
+    return SnapshotTraits< unsigned char >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< short >::view_type offset() const
+{
+    return SnapshotTraits< short >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< float >::view_type value() const
+{
+    return SnapshotTraits< float >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::vector<signed char> >::view_type deltas() const
+{
+    return SnapshotTraits< std::vector<signed char> >::view(m_region, m_table + 3 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::Sample > {
+    typedef SnapshotView< ::config::Sample > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::Sample& value)
+    {
+        std::size_t table = builder.allocate(4 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< unsigned char >::write(builder, table + 0 * snapshot::slot_size, value.channel);
+SnapshotTraits< short >::write(builder, table + 1 * snapshot::slot_size, value.offset);
+SnapshotTraits< float >::write(builder, table + 2 * snapshot::slot_size, value.value);
+SnapshotTraits< std::vector<signed char> >::write(builder, table + 3 * snapshot::slot_size, value.deltas);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct Device {
+ autojsoncxx::uuid id;
+autojsoncxx::ipv4_address address;
+autojsoncxx::ipv6_address gateway;
+std::chrono::system_clock::time_point last_seen;
+std::string contact;
+autojsoncxx::bytes firmware;
+
+explicit Device():id(), address(), gateway(), last_seen(), contact(), firmware() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::Device > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< autojsoncxx::uuid > handler_0;
+SAXEventHandler< autojsoncxx::ipv4_address > handler_1;
+SAXEventHandler< autojsoncxx::ipv6_address > handler_2;
+SAXEventHandler< std::chrono::system_clock::time_point > handler_3;
+SAXEventHandler< std::string > handler_4;
+SAXEventHandler< autojsoncxx::bytes > handler_5;
+utility::uint64_t has_flags[1];
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "id";
+case 1:
+    return "address";
+case 2:
+    return "gateway";
+case 3:
+    return "last_seen";
+case 4:
+    return "contact";
+case 5:
+    return "firmware";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::Device * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->id)
+, handler_1(&obj->address)
+, handler_2(&obj->gateway)
+, handler_3(&obj->last_seen)
+, handler_4(&obj->contact)
+, handler_5(&obj->firmware)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+case 2:
+    return checked_event_forwarding(handler_2.Null());
+
+case 3:
+    return checked_event_forwarding(handler_3.Null());
+
+case 4:
+    return checked_event_forwarding(handler_4.Null());
+
+case 5:
+    return checked_event_forwarding(handler_5.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+case 2:
+    return checked_event_forwarding(handler_2.Bool(b));
+
+case 3:
+    return checked_event_forwarding(handler_3.Bool(b));
+
+case 4:
+    return checked_event_forwarding(handler_4.Bool(b));
+
+case 5:
+    return checked_event_forwarding(handler_5.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Int64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Int64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Int64(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+case 2:
+    return checked_event_forwarding(handler_2.Uint64(i));
+
+case 3:
+    return checked_event_forwarding(handler_3.Uint64(i));
+
+case 4:
+    return checked_event_forwarding(handler_4.Uint64(i));
+
+case 5:
+    return checked_event_forwarding(handler_5.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+case 2:
+    return checked_event_forwarding(handler_2.Double(d));
+
+case 3:
+    return checked_event_forwarding(handler_3.Double(d));
+
+case 4:
+    return checked_event_forwarding(handler_4.Double(d));
+
+case 5:
+    return checked_event_forwarding(handler_5.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.String(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.String(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.String(str, length, copy));
+
+case 5:
+    return checked_event_forwarding(handler_5.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x69\x64", 2))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x61\x64\x64\x72\x65\x73\x73", 7))
+                         { state=1;  has_flags[0] |= 0x2ULL; }
+else if (utility::string_equal(str, length, "\x67\x61\x74\x65\x77\x61\x79", 7))
+                         { state=2;   }
+else if (utility::string_equal(str, length, "\x6c\x61\x73\x74\x5f\x73\x65\x65\x6e", 9))
+                         { state=3;   }
+else if (utility::string_equal(str, length, "\x63\x6f\x6e\x74\x61\x63\x74", 7))
+                         { state=4;   }
+else if (utility::string_equal(str, length, "\x66\x69\x72\x6d\x77\x61\x72\x65", 8))
+                         { state=5;   }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+case 2:
+    return checked_event_forwarding(handler_2.Key(str, length, copy));
+
+case 3:
+    return checked_event_forwarding(handler_3.Key(str, length, copy));
+
+case 4:
+    return checked_event_forwarding(handler_4.Key(str, length, copy));
+
+case 5:
+    return checked_event_forwarding(handler_5.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     has_flags[0] |= 0x2ULL;
+    break;
+
+case 2:
+    state = 2;
+     
+    break;
+
+case 3:
+    state = 3;
+     
+    break;
+
+case 4:
+    state = 4;
+     
+    break;
+
+case 5:
+    state = 5;
+     
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartArray());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartArray());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartArray());
+
+case 5:
+    return checked_event_forwarding(handler_5.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndArray(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndArray(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndArray(length));
+
+case 5:
+    return checked_event_forwarding(handler_5.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+case 2:
+    return checked_event_forwarding(handler_2.StartObject());
+
+case 3:
+    return checked_event_forwarding(handler_3.StartObject());
+
+case 4:
+    return checked_event_forwarding(handler_4.StartObject());
+
+case 5:
+    return checked_event_forwarding(handler_5.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+case 2:
+    return checked_event_forwarding(handler_2.EndObject(length));
+
+case 3:
+    return checked_event_forwarding(handler_3.EndObject(length));
+
+case 4:
+    return checked_event_forwarding(handler_4.EndObject(length));
+
+case 5:
+    return checked_event_forwarding(handler_5.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x3ULL) != 0x3ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "id");
+if (!(has_flags[0] & 0x2ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "address");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+case 2:
+     handler_2.ReapError(errs); break;
+case 3:
+     handler_3.ReapError(errs); break;
+case 4:
+     handler_4.ReapError(errs); break;
+case 5:
+     handler_5.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+handler_2.PrepareForReuse();
+handler_3.PrepareForReuse();
+handler_4.PrepareForReuse();
+handler_5.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >
+struct Serializer< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead, ::config::Device > {
+
+    void operator()( Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead& w, const ::config::Device& value) const
+    {
+        ContainerStarter< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >::object(w, 6);
+
+        KeyWriter< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >()(w, "\x69\x64", 2, "\x22\x69\x64\x22\x3a", 5);
+Serializer< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead, autojsoncxx::uuid >()(w, value.id);
+KeyWriter< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >()(w, "\x61\x64\x64\x72\x65\x73\x73", 7, "\x2c\x22\x61\x64\x64\x72\x65\x73\x73\x22\x3a", 11);
+Serializer< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead, autojsoncxx::ipv4_address >()(w, value.address);
+KeyWriter< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >()(w, "\x67\x61\x74\x65\x77\x61\x79", 7, "\x2c\x22\x67\x61\x74\x65\x77\x61\x79\x22\x3a", 11);
+Serializer< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead, autojsoncxx::ipv6_address >()(w, value.gateway);
+KeyWriter< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >()(w, "\x6c\x61\x73\x74\x5f\x73\x65\x65\x6e", 9, "\x2c\x22\x6c\x61\x73\x74\x5f\x73\x65\x65\x6e\x22\x3a", 13);
+Serializer< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead, std::chrono::system_clock::time_point >()(w, value.last_seen);
+KeyWriter< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >()(w, "\x63\x6f\x6e\x74\x61\x63\x74", 7, "\x2c\x22\x63\x6f\x6e\x74\x61\x63\x74\x22\x3a", 11);
+Serializer< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead, std::string >()(w, value.contact);
+KeyWriter< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead >()(w, "\x66\x69\x72\x6d\x77\x61\x72\x65", 8, "\x2c\x22\x66\x69\x72\x6d\x77\x61\x72\x65\x22\x3a", 12);
+Serializer< Writer38e56cc264f281058b02b89561a0a72396b6623d7ca6ca06dd634da3b10d7ead, autojsoncxx::bytes >()(w, value.firmware);
+
+        w.EndObject(6);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::Device > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x0d8f9d025e330780ULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::Device& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< autojsoncxx::uuid >::wire_type);
+BinaryCodec< autojsoncxx::uuid >::write(out, value.id);
+out.put_tag(2, BinaryCodec< autojsoncxx::ipv4_address >::wire_type);
+BinaryCodec< autojsoncxx::ipv4_address >::write(out, value.address);
+out.put_tag(3, BinaryCodec< autojsoncxx::ipv6_address >::wire_type);
+BinaryCodec< autojsoncxx::ipv6_address >::write(out, value.gateway);
+out.put_tag(4, BinaryCodec< std::chrono::system_clock::time_point >::wire_type);
+BinaryCodec< std::chrono::system_clock::time_point >::write(out, value.last_seen);
+out.put_tag(5, BinaryCodec< std::string >::wire_type);
+BinaryCodec< std::string >::write(out, value.contact);
+out.put_tag(6, BinaryCodec< autojsoncxx::bytes >::wire_type);
+BinaryCodec< autojsoncxx::bytes >::write(out, value.firmware);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::Device& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< autojsoncxx::uuid >::wire_type
+        || !BinaryCodec< autojsoncxx::uuid >::read(in, value.id))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< autojsoncxx::ipv4_address >::wire_type
+        || !BinaryCodec< autojsoncxx::ipv4_address >::read(in, value.address))
+        return false;
+    break;
+case 3:
+    if (wire_type != BinaryCodec< autojsoncxx::ipv6_address >::wire_type
+        || !BinaryCodec< autojsoncxx::ipv6_address >::read(in, value.gateway))
+        return false;
+    break;
+case 4:
+    if (wire_type != BinaryCodec< std::chrono::system_clock::time_point >::wire_type
+        || !BinaryCodec< std::chrono::system_clock::time_point >::read(in, value.last_seen))
+        return false;
+    break;
+case 5:
+    if (wire_type != BinaryCodec< std::string >::wire_type
+        || !BinaryCodec< std::string >::read(in, value.contact))
+        return false;
+    break;
+case 6:
+    if (wire_type != BinaryCodec< autojsoncxx::bytes >::wire_type
+        || !BinaryCodec< autojsoncxx::bytes >::read(in, value.firmware))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::Device > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 6 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< autojsoncxx::uuid >::view_type id() const
+{
+    return SnapshotTraits< autojsoncxx::uuid >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< autojsoncxx::ipv4_address >::view_type address() const
+{
+    return SnapshotTraits< autojsoncxx::ipv4_address >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+
+SnapshotTraits< autojsoncxx::ipv6_address >::view_type gateway() const
+{
+    return SnapshotTraits< autojsoncxx::ipv6_address >::view(m_region, m_table + 2 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::chrono::system_clock::time_point >::view_type last_seen() const
+{
+    return SnapshotTraits< std::chrono::system_clock::time_point >::view(m_region, m_table + 3 * snapshot::slot_size);
+}
+
+SnapshotTraits< std::string >::view_type contact() const
+{
+    return SnapshotTraits< std::string >::view(m_region, m_table + 4 * snapshot::slot_size);
+}
+
+SnapshotTraits< autojsoncxx::bytes >::view_type firmware() const
+{
+    return SnapshotTraits< autojsoncxx::bytes >::view(m_region, m_table + 5 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::Device > {
+    typedef SnapshotView< ::config::Device > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::Device& value)
+    {
+        std::size_t table = builder.allocate(6 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< autojsoncxx::uuid >::write(builder, table + 0 * snapshot::slot_size, value.id);
+SnapshotTraits< autojsoncxx::ipv4_address >::write(builder, table + 1 * snapshot::slot_size, value.address);
+SnapshotTraits< autojsoncxx::ipv6_address >::write(builder, table + 2 * snapshot::slot_size, value.gateway);
+SnapshotTraits< std::chrono::system_clock::time_point >::write(builder, table + 3 * snapshot::slot_size, value.last_seen);
+SnapshotTraits< std::string >::write(builder, table + 4 * snapshot::slot_size, value.contact);
+SnapshotTraits< autojsoncxx::bytes >::write(builder, table + 5 * snapshot::slot_size, value.firmware);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct Circle {
+ double radius;
+
+explicit Circle():radius() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::Circle > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< double > handler_0;
+utility::uint64_t has_flags[1];
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "radius";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::Circle * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->radius)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x72\x61\x64\x69\x75\x73", 6))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x1ULL) != 0x1ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "radius");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writer9c736c557fe502ff2cd587e269dc8fb218d29405d840c743c7d45db0a3f68dbd >
+struct Serializer< Writer9c736c557fe502ff2cd587e269dc8fb218d29405d840c743c7d45db0a3f68dbd, ::config::Circle > {
+
+    void operator()( Writer9c736c557fe502ff2cd587e269dc8fb218d29405d840c743c7d45db0a3f68dbd& w, const ::config::Circle& value) const
+    {
+        ContainerStarter< Writer9c736c557fe502ff2cd587e269dc8fb218d29405d840c743c7d45db0a3f68dbd >::object(w, 1);
+
+        KeyWriter< Writer9c736c557fe502ff2cd587e269dc8fb218d29405d840c743c7d45db0a3f68dbd >()(w, "\x72\x61\x64\x69\x75\x73", 6, "\x22\x72\x61\x64\x69\x75\x73\x22\x3a", 9);
+Serializer< Writer9c736c557fe502ff2cd587e269dc8fb218d29405d840c743c7d45db0a3f68dbd, double >()(w, value.radius);
+
+        w.EndObject(1);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::Circle > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x2d604afe216a4ec3ULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::Circle& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.radius);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::Circle& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.radius))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::Circle > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 1 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< double >::view_type radius() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::Circle > {
+    typedef SnapshotView< ::config::Circle > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::Circle& value)
+    {
+        std::size_t table = builder.allocate(1 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< double >::write(builder, table + 0 * snapshot::slot_size, value.radius);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Siyuan Ren (netheril96@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+// The comments are reserved for replacement
+// such syntax is chosen so that the template file looks like valid C++
+
+namespace config { struct Rectangle {
+ double width;
+double height;
+
+explicit Rectangle():width(), height() {  }
+
+
+ 
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+class SAXEventHandler< ::config::Rectangle > {
+private:
+    error::ErrorHolder the_error;
+    int state;
+    int depth;
+
+    SAXEventHandler< double > handler_0;
+SAXEventHandler< double > handler_1;
+utility::uint64_t has_flags[1];
+
+    bool check_depth(const char* type)
+    {
+        if (depth <= 0) {
+            the_error.set<error::TypeMismatchError>("object", type);
+            return false;
+        }
+        return true;
+    }
+
+    const char* current_member_name() const
+    {
+        switch (state) {
+            case 0:
+    return "width";
+case 1:
+    return "height";
+        default:
+            break;
+        }
+        return "<UNKNOWN>";
+    }
+
+    bool checked_event_forwarding(bool success)
+    {
+        if (!success)
+            the_error.set<error::ObjectMemberError>(current_member_name());
+        return success;
+    }
+
+    // Checks the constraints of the definition file on a member once its value is complete
+    bool validate_member(int index)
+    {
+        switch (index) {
+            
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void reset_flags()
+    {
+        has_flags[0] = 0;
+    }
+
+public:
+    explicit SAXEventHandler( ::config::Rectangle * obj)
+        : state(-1)
+        , depth(0)
+        , handler_0(&obj->width)
+, handler_1(&obj->height)
+    {
+        reset_flags();
+    }
+
+    bool Null()
+    {
+        if (!check_depth("null"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Null());
+
+case 1:
+    return checked_event_forwarding(handler_1.Null());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if (!check_depth("bool"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Bool(b));
+
+case 1:
+    return checked_event_forwarding(handler_1.Bool(b));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        if (!check_depth("int"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        if (!check_depth("unsigned"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Int64(utility::int64_t i)
+    {
+        if (!check_depth("int64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Int64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Int64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Uint64(utility::uint64_t i)
+    {
+        if (!check_depth("uint64_t"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Uint64(i));
+
+case 1:
+    return checked_event_forwarding(handler_1.Uint64(i));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        if (!check_depth("double"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.Double(d));
+
+case 1:
+    return checked_event_forwarding(handler_1.Double(d));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool String(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("string"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.String(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.String(str, length, copy));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Key(const char* str, SizeType length, bool copy)
+    {
+        if (!check_depth("object"))
+            return false;
+
+        if (depth == 1) {
+            if (!validate_member(state))
+                return false;
+
+            if (0) {
+            }
+            else if (utility::string_equal(str, length, "\x77\x69\x64\x74\x68", 5))
+                         { state=0;  has_flags[0] |= 0x1ULL; }
+else if (utility::string_equal(str, length, "\x68\x65\x69\x67\x68\x74", 6))
+                         { state=1;  has_flags[0] |= 0x2ULL; }
+            else {
+                state = -1;
+                return true;
+            }
+
+        } else {
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.Key(str, length, copy));
+
+case 1:
+    return checked_event_forwarding(handler_1.Key(str, length, copy));
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool SelectMember(int index)
+    {
+        if (!validate_member(state))
+            return false;
+
+        switch (index) {
+
+        case 0:
+    state = 0;
+     has_flags[0] |= 0x1ULL;
+    break;
+
+case 1:
+    state = 1;
+     has_flags[0] |= 0x2ULL;
+    break;
+
+        default:
+            state = -1;
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.StartArray());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartArray());
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool EndArray(SizeType length)
+    {
+        if (!check_depth("array"))
+            return false;
+
+        switch (state) {
+
+        case 0:
+    return checked_event_forwarding(handler_0.EndArray(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndArray(length));
+
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        ++depth;
+        if (depth > 1) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.StartObject());
+
+case 1:
+    return checked_event_forwarding(handler_1.StartObject());
+
+            default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType length)
+    {
+        --depth;
+        if (depth > 0) {
+
+            switch (state) {
+
+            case 0:
+    return checked_event_forwarding(handler_0.EndObject(length));
+
+case 1:
+    return checked_event_forwarding(handler_1.EndObject(length));
+
+            default:
+                break;
+            }
+        } else {
+            if (!validate_member(state))
+                return false;
+            if ((has_flags[0] & 0x3ULL) != 0x3ULL) the_error.set<error::RequiredFieldMissingError>();
+        }
+        return the_error.empty();
+    }
+
+    bool HasError() const
+    {
+        return !this->the_error.empty();
+    }
+
+    bool ReapError(error::ErrorStack& errs)
+    {
+        if (this->the_error.empty())
+            return false;
+
+        // The missing members are only listed when the error is reaped
+        error::ErrorBase* reaped = the_error.move_to(errs);
+        if (reaped && reaped->type() == error::MISSING_REQUIRED) {
+            if (!(has_flags[0] & 0x1ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "width");
+if (!(has_flags[0] & 0x2ULL)) static_cast<error::RequiredFieldMissingError*>(reaped)->add_missing_member(errs, "height");
+        }
+
+        switch (state) {
+
+        case 0:
+     handler_0.ReapError(errs); break;
+case 1:
+     handler_1.ReapError(errs); break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void PrepareForReuse()
+    {
+        depth = 0;
+        state = -1;
+        the_error.reset();
+        reset_flags();
+        handler_0.PrepareForReuse();
+handler_1.PrepareForReuse();
+
+    }
+};
+
+
+template < class Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5 >
+struct Serializer< Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5, ::config::Rectangle > {
+
+    void operator()( Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5& w, const ::config::Rectangle& value) const
+    {
+        ContainerStarter< Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5 >::object(w, 2);
+
+        KeyWriter< Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5 >()(w, "\x77\x69\x64\x74\x68", 5, "\x22\x77\x69\x64\x74\x68\x22\x3a", 8);
+Serializer< Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5, double >()(w, value.width);
+KeyWriter< Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5 >()(w, "\x68\x65\x69\x67\x68\x74", 6, "\x2c\x22\x68\x65\x69\x67\x68\x74\x22\x3a", 10);
+Serializer< Writer6800a14c566bcce7a1e70e43a20313010e7155b53c2ff4bc473e1c3473b91fa5, double >()(w, value.height);
+
+        w.EndObject(2);
+    }
+
+};
+
+template <>
+struct BinaryCodec< ::config::Rectangle > {
+    static const int wire_type = binary::kLengthDelimited;
+
+    static utility::uint64_t fingerprint()
+    {
+        return 0x79f07e8e62c557f0ULL;
+    }
+
+    static void write(BinaryOutput& out, const ::config::Rectangle& value)
+    {
+        out.begin_nested();
+
+        out.put_tag(1, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.width);
+out.put_tag(2, BinaryCodec< double >::wire_type);
+BinaryCodec< double >::write(out, value.height);
+
+        out.end_nested();
+    }
+
+    static bool read(BinaryInput& in, ::config::Rectangle& value)
+    {
+        const char* limit;
+        if (!in.begin_nested(limit))
+            return false;
+
+        while (!in.at_end()) {
+            unsigned field;
+            int wire_type;
+            if (!in.read_tag(field, wire_type))
+                return false;
+
+            switch (field) {
+            case 1:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.width))
+        return false;
+    break;
+case 2:
+    if (wire_type != BinaryCodec< double >::wire_type
+        || !BinaryCodec< double >::read(in, value.height))
+        return false;
+    break;
+
+            default:
+                if (!in.skip(wire_type))
+                    return false;
+            }
+        }
+        in.end_nested(limit);
+        return true;
+    }
+};
+
+template <>
+class SnapshotView< ::config::Rectangle > {
+private:
+    snapshot::Region m_region;
+    utility::uint64_t m_table;
+
+public:
+    explicit SnapshotView()
+        : m_region()
+        , m_table(0)
+    {
+    }
+
+    explicit SnapshotView(const snapshot::Region& region, utility::uint64_t table)
+        : m_region(table != 0 && region.contains(table, 2 * snapshot::slot_size) ? region : snapshot::Region())
+        , m_table(table)
+    {
+    }
+
+    SnapshotTraits< double >::view_type width() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 0 * snapshot::slot_size);
+}
+
+SnapshotTraits< double >::view_type height() const
+{
+    return SnapshotTraits< double >::view(m_region, m_table + 1 * snapshot::slot_size);
+}
+};
+
+template <>
+struct SnapshotTraits< ::config::Rectangle > {
+    typedef SnapshotView< ::config::Rectangle > view_type;
+
+    static void write(SnapshotBuilder& builder, std::size_t slot, const ::config::Rectangle& value)
+    {
+        std::size_t table = builder.allocate(2 * snapshot::slot_size);
+        builder.store_offset(slot, table);
+
+        SnapshotTraits< double >::write(builder, table + 0 * snapshot::slot_size, value.width);
+SnapshotTraits< double >::write(builder, table + 1 * snapshot::slot_size, value.height);
+    }
+
+    static view_type view(const snapshot::Region& region, utility::uint64_t slot)
+    {
+        return view_type(region, region.read_offset(slot));
+    }
+};
+}
+
+
+
+#include <autojsoncxx/autojsoncxx.hpp>
+
+namespace config { struct Shape {
+ enum Tag { circle_tag, rectangle_tag };
+ Tag tag;
+ config::Circle circle;
+config::Rectangle rectangle;
+
+explicit Shape() : tag(circle_tag), circle(), rectangle() {}
+}; }
+
+
+namespace autojsoncxx {
+
+template <>
+struct TaggedUnionTraits< ::config::Shape > {
+    static const char* type_name()
+    {
+        return "::config::Shape";
+    }
+
+    static const EnumSpelling& discriminator()
+    {
+        static const EnumSpelling result = { "\x6b\x69\x6e\x64", 4, "\x22\x6b\x69\x6e\x64\x22\x3a", 7 };
+        return result;
+    }
+
+    static SizeType count()
+    {
+        return 2;
+    }
+
+    static const EnumSpelling* tags()
+    {
+        static const EnumSpelling result[] = {
+            { "\x63\x69\x72\x63\x6c\x65", 6, "\x22\x63\x69\x72\x63\x6c\x65\x22", 8 },
+{ "\x72\x65\x63\x74", 4, "\x22\x72\x65\x63\x74\x22", 6 }
+        };
+        return result;
+    }
+
+    static int find(const char* str, SizeType length)
+    {
+        static const int slots[] = { 0, -1, 1, -1 };
+        return internal::find_spelling(tags(), str, length, slots, 1u, 3u);
+    }
+};
+
+template <>
+class SAXEventHandler< ::config::Shape >
+    : public TaggedUnionSAXEventHandler< ::config::Shape, SAXEventHandler< ::config::Shape > > {
+private:
+    ::config::Shape * m_value;
+    internal::ErasedSAXEventHandler< config::Circle > handler_0;
+internal::ErasedSAXEventHandler< config::Rectangle > handler_1;
+
+public:
+    explicit SAXEventHandler( ::config::Shape * obj)
+        : m_value(obj)
+        , handler_0(&obj->circle)
+, handler_1(&obj->rectangle)
+    {
+    }
+
+    // Sets the tag and returns the handler of the alternative
+    internal::ErasedSAXEventHandlerBase* alternative(int index)
+    {
+        switch (index) {
+            case 0:
+ m_value->tag = ::config::Shape::circle_tag;
+ return &handler_0;
+case 1:
+ m_value->tag = ::config::Shape::rectangle_tag;
+ return &handler_1;
+        default:
+            return 0;
+        }
+    }
+};
+
+template <class Writer>
+struct Serializer<Writer, ::config::Shape > {
+    void operator()(Writer& w, const ::config::Shape & value) const
+    {
+        typedef TaggedUnionTraits< ::config::Shape > traits;
+        switch (value.tag) {
+            case ::config::Shape::circle_tag:
+ write_alternative(w, traits::discriminator(), traits::tags()[0], value.circle);
+ break;
+case ::config::Shape::rectangle_tag:
+ write_alternative(w, traits::discriminator(), traits::tags()[1], value.rectangle);
+ break;
+        default:
+            w.Null();
+        }
+    }
+};
+}